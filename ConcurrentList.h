@@ -0,0 +1,295 @@
+#ifndef CONCURRENTLIST_H
+#define CONCURRENTLIST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// 并发双向链表：多个线程可同时插入、删除、遍历，取代"List + 一把全局互斥锁"
+//
+// 同步方式（惰性同步）：
+//   - 每个节点一把自旋锁。修改链接时只锁住涉及的相邻节点，且总是从左到右加锁，
+//     因此不会死锁；链表不同部位的修改互不阻塞。
+//   - 加锁前不加锁地读出前驱，加锁后再验证（前驱未被删除且后继仍是本节点），验证失败则重试。
+//   - 删除先把节点标记为已删除（逻辑删除），再摘下（物理删除）。遍历与查找完全不加锁，
+//     跳过已标记的节点；被摘下的节点仍保留后继指针，正在其上的遍历可以继续走下去。
+//
+// 内存回收（纪元回收）：所有操作都在 Guard 内进行，Guard 登记当前纪元。
+// 摘下的节点按摘下时的纪元放入回收队列，全局纪元前进两次后（此前进入的 Guard 已全部退出）
+// 才真正释放，因此任何线程都不会访问到已释放的节点。
+//
+// 位置（CListNodePosi）的有效期：insertA/insertB/remove 的参数 p 须在调用期间未被释放——
+// 或者调用者在取得 p 之后一直持有 Guard，或者保证不会有其他线程删除 p。
+// p 已被其他线程删除时，insertA/insertB 返回 nullptr，remove 返回 false。
+//
+// 元素个数分散计入若干个计数条带（按线程选取），size() 为各条带之和，并发修改时为近似值。
+
+template <typename T>
+struct CListNode {
+    T data;
+    std::atomic<CListNode<T>*> pred;  // 前驱
+    std::atomic<CListNode<T>*> succ;  // 后继
+    std::atomic<bool> marked;         // 已逻辑删除
+    std::atomic<bool> locked;         // 节点自旋锁
+
+    CListNode() : data(), pred(nullptr), succ(nullptr), marked(false), locked(false) {}  // 哨兵
+    template <typename U>
+    explicit CListNode(U&& e) : data(std::forward<U>(e)), pred(nullptr), succ(nullptr), marked(false), locked(false) {}
+};
+
+template <typename T>
+using CListNodePosi = CListNode<T>*;
+
+const int CLIST_STRIPES = 16;         // 计数条带数
+const int CLIST_RECLAIM_BATCH = 64;   // 条带回收队列积累到该长度时尝试推进纪元并回收（最小值）
+
+template <typename T>
+class ConcurrentList {
+private:
+    typedef CListNode<T> Node;
+    typedef CListNodePosi<T> Posi;
+
+    // 计数条带：元素个数增量、两个纪元奇偶位上的活跃 Guard 数、回收队列
+    struct alignas(64) Stripe {
+        std::atomic<long long> size;
+        std::atomic<long long> active[2];
+        std::mutex retireLock;
+        std::vector<std::pair<unsigned long long, Posi>> retired;  // （摘下时的纪元, 节点）
+        size_t reclaimAt;  // 回收队列达到该长度时尝试回收；回收后仍积压则加倍，避免反复扫描
+        Stripe() : size(0), reclaimAt(CLIST_RECLAIM_BATCH) { active[0] = active[1] = 0; }
+    };
+
+    Posi header;   // 头哨兵
+    Posi trailer;  // 尾哨兵
+    alignas(64) std::atomic<unsigned long long> _epoch;  // 全局纪元
+    Stripe _stripes[CLIST_STRIPES];
+
+    // 当前线程使用的条带（线程首次使用时轮流分配）
+    static int stripeOf() {
+        static std::atomic<int> next(0);
+        thread_local int s = next.fetch_add(1, std::memory_order_relaxed) % CLIST_STRIPES;
+        return s;
+    }
+
+    static void lock(Posi p) {
+        int spins = 0;
+        while (p->locked.exchange(true, std::memory_order_acquire))
+            while (p->locked.load(std::memory_order_relaxed))
+                if (++spins > 64) std::this_thread::yield();
+    }
+    static void unlock(Posi p) { p->locked.store(false, std::memory_order_release); }
+
+    // 纪元 e 时进入的 Guard 全部退出后，纪元才能从 e+1 推进到 e+2
+    void tryAdvance() {
+        unsigned long long e = _epoch.load();
+        long long busy = 0;
+        for (int i = 0; i < CLIST_STRIPES; i++) busy += _stripes[i].active[(e + 1) & 1].load();
+        if (busy == 0) _epoch.compare_exchange_strong(e, e + 1);
+    }
+
+    // 节点 p 已摘下：放入回收队列，并释放队列中摘下后纪元已前进两次的节点
+    void retire(Posi p) {
+        Stripe& s = _stripes[stripeOf()];
+        std::lock_guard<std::mutex> g(s.retireLock);
+        s.retired.push_back(std::make_pair(_epoch.load(), p));
+        if (s.retired.size() < s.reclaimAt) return;
+        tryAdvance();
+        unsigned long long e = _epoch.load();
+        size_t k = 0;
+        for (size_t i = 0; i < s.retired.size(); i++) {
+            if (s.retired[i].first + 2 <= e) delete s.retired[i].second;
+            else s.retired[k++] = s.retired[i];
+        }
+        s.retired.resize(k);
+        s.reclaimAt = std::max((size_t)CLIST_RECLAIM_BATCH, 2 * k);
+    }
+
+    void sizeAdd(long long d) { _stripes[stripeOf()].size.fetch_add(d, std::memory_order_relaxed); }
+
+    // 在 p 之后插入：锁住 p 及其后继，p 已被删除时返回 nullptr
+    template <typename U>
+    Posi linkA(Posi p, U&& e) {
+        if (p == trailer) return nullptr;
+        Guard g(*this);
+        Posi x = new Node(std::forward<U>(e));
+        lock(p);
+        if (p->marked.load()) {
+            unlock(p);
+            delete x;
+            return nullptr;
+        }
+        Posi s = p->succ.load(std::memory_order_relaxed);  // p 已锁住，其后继不会改变，也不会被删除
+        lock(s);
+        x->pred.store(p, std::memory_order_relaxed);
+        x->succ.store(s, std::memory_order_relaxed);
+        s->pred.store(x, std::memory_order_release);
+        p->succ.store(x, std::memory_order_release);  // 此后遍历可见 x
+        unlock(s);
+        unlock(p);
+        sizeAdd(1);
+        return x;
+    }
+
+    // 在 p 之前插入：锁住 p 的前驱并验证，再锁住 p，p 已被删除时返回 nullptr
+    template <typename U>
+    Posi linkB(Posi p, U&& e) {
+        if (p == header) return nullptr;
+        Guard g(*this);
+        Posi x = new Node(std::forward<U>(e));
+        for (;;) {
+            if (p->marked.load()) {
+                delete x;
+                return nullptr;
+            }
+            Posi q = p->pred.load(std::memory_order_acquire);
+            lock(q);
+            if (q->marked.load() || q->succ.load(std::memory_order_relaxed) != p) {  // 前驱已变，重试
+                unlock(q);
+                continue;
+            }
+            lock(p);  // q 未删除且后继为 p，则 p 也未删除
+            x->pred.store(q, std::memory_order_relaxed);
+            x->succ.store(p, std::memory_order_relaxed);
+            p->pred.store(x, std::memory_order_release);
+            q->succ.store(x, std::memory_order_release);
+            unlock(p);
+            unlock(q);
+            sizeAdd(1);
+            return x;
+        }
+    }
+
+    // 删除 p：依次锁住前驱、p、后继，标记后摘下；out 非空时复制出数据
+    bool unlinkNode(Posi p, T* out) {
+        if (!valid(p)) return false;
+        Guard g(*this);
+        for (;;) {
+            if (p->marked.load()) return false;  // 已被其他线程删除
+            Posi q = p->pred.load(std::memory_order_acquire);
+            lock(q);
+            if (q->marked.load() || q->succ.load(std::memory_order_relaxed) != p) {
+                unlock(q);
+                continue;
+            }
+            lock(p);
+            Posi s = p->succ.load(std::memory_order_relaxed);
+            lock(s);
+            if (out) *out = p->data;  // 遍历可能正在读 p->data，只能复制
+            p->marked.store(true);
+            q->succ.store(s, std::memory_order_release);
+            s->pred.store(q, std::memory_order_release);
+            unlock(s);
+            unlock(p);
+            unlock(q);
+            sizeAdd(-1);
+            retire(p);
+            return true;
+        }
+    }
+
+public:
+    // 纪元登记：持有期间读到的任何节点都不会被释放。可以嵌套
+    class Guard {
+    private:
+        std::atomic<long long>* _slot;  // 登记所在的计数
+    public:
+        explicit Guard(ConcurrentList& L) {
+            Stripe& s = L._stripes[stripeOf()];
+            for (;;) {
+                unsigned long long e = L._epoch.load();
+                _slot = &s.active[e & 1];
+                _slot->fetch_add(1);
+                if (L._epoch.load() == e) return;  // 登记期间纪元未变
+                _slot->fetch_sub(1);
+            }
+        }
+        ~Guard() { _slot->fetch_sub(1, std::memory_order_release); }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    ConcurrentList() : header(new Node), trailer(new Node), _epoch(0) {
+        header->succ.store(trailer, std::memory_order_relaxed);
+        trailer->pred.store(header, std::memory_order_relaxed);
+    }
+
+    ConcurrentList(const ConcurrentList&) = delete;
+    ConcurrentList& operator=(const ConcurrentList&) = delete;
+
+    // 析构时须已无其他线程访问
+    ~ConcurrentList() {
+        for (Posi p = header; p;) {
+            Posi next = p->succ.load(std::memory_order_relaxed);
+            delete p;
+            p = next;
+        }
+        for (int i = 0; i < CLIST_STRIPES; i++)
+            for (size_t k = 0; k < _stripes[i].retired.size(); k++) delete _stripes[i].retired[k].second;
+    }
+
+    // 元素个数（并发修改时为近似值）
+    long long size() const {
+        long long n = 0;
+        for (int i = 0; i < CLIST_STRIPES; i++) n += _stripes[i].size.load(std::memory_order_relaxed);
+        return n > 0 ? n : 0;
+    }
+    // 判断是否为空（瞬时值）
+    bool empty() const { return header->succ.load(std::memory_order_acquire) == trailer; }
+
+    // 首、末节点（瞬时值；空表时分别为尾、头哨兵）。须在 Guard 内使用
+    Posi first() const { return header->succ.load(std::memory_order_acquire); }
+    Posi last() const { return trailer->pred.load(std::memory_order_acquire); }
+
+    // 判断 p 是否为实际节点（非哨兵且非空）
+    bool valid(Posi p) const { return p && p != header && p != trailer; }
+
+    // 插入，返回新节点位置；p 已被删除时返回 nullptr
+    Posi insertAsFirst(T const& e) { return linkA(header, e); }
+    Posi insertAsFirst(T&& e) { return linkA(header, std::move(e)); }
+    Posi insertAsLast(T const& e) { return linkB(trailer, e); }
+    Posi insertAsLast(T&& e) { return linkB(trailer, std::move(e)); }
+    Posi insertA(Posi p, T const& e) { return linkA(p, e); }  // 在 p 之后插入
+    Posi insertA(Posi p, T&& e) { return linkA(p, std::move(e)); }
+    Posi insertB(Posi p, T const& e) { return linkB(p, e); }  // 在 p 之前插入
+    Posi insertB(Posi p, T&& e) { return linkB(p, std::move(e)); }
+
+    // 删除 p，成功时把数据复制到 e；p 已被其他线程删除时返回 false
+    bool remove(Posi p, T& e) { return unlinkNode(p, &e); }
+    bool remove(Posi p) { return unlinkNode(p, nullptr); }
+
+    // 删除首、末元素（空表时返回 false），用作并发队列/双端队列
+    bool removeFirst(T& e) {
+        Guard g(*this);
+        for (Posi p = first(); valid(p); p = first())
+            if (unlinkNode(p, &e)) return true;
+        return false;
+    }
+    bool removeLast(T& e) {
+        Guard g(*this);
+        for (Posi p = last(); valid(p); p = last())
+            if (unlinkNode(p, &e)) return true;
+        return false;
+    }
+
+    // 查找第一个等于 e 的元素，返回其位置或 nullptr。须在 Guard 内使用返回值
+    Posi find(T const& e) {
+        Guard g(*this);
+        for (Posi p = first(); p != trailer; p = p->succ.load(std::memory_order_acquire))
+            if (!p->marked.load(std::memory_order_acquire) && p->data == e) return p;
+        return nullptr;
+    }
+
+    // 遍历：不加锁，跳过已删除的元素；遍历期间其他线程的插入、删除可能看到也可能看不到
+    template <typename VST>
+    void traverse(VST& visit) {
+        Guard g(*this);
+        for (Posi p = first(); p != trailer; p = p->succ.load(std::memory_order_acquire))
+            if (!p->marked.load(std::memory_order_acquire)) visit(static_cast<T const&>(p->data));
+    }
+};
+
+#endif // CONCURRENTLIST_H
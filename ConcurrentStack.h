@@ -0,0 +1,156 @@
+#ifndef CONCURRENTSTACK_H
+#define CONCURRENTSTACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+// 无锁并发栈（Treiber 栈），可在多个线程间共享
+//
+// 节点全部来自栈自带的节点池，用 32 位下标而非指针相互引用。
+// 栈顶与空闲链表表头都是 64 位原子量：高 32 位为版本号（tag），低 32 位为节点下标，
+// 每次修改表头版本号加 1，因此即使节点被弹出、回收、再压入（ABA），旧的 CAS 也必然失败。
+//
+// 内存回收：弹出的节点立即回到池的空闲链表供后续 push 复用，但节点内存在栈析构前
+// 从不归还系统（类型稳定内存）。其他线程即使仍持有某个已回收节点的下标，
+// 读取其 next 也只会读到一个合法的旧值，随后因版本号不符而 CAS 失败重试，
+// 故无需危险指针或纪元回收即可安全访问。
+//
+// 节点池按 slab 增长：第 k 个 slab 含 BASE << k 个节点，下标空间 32 位，最多 MAX_SLABS 个 slab。
+template <typename T>
+class ConcurrentStack {
+private:
+    static const uint32_t NIL = 0xFFFFFFFFu;   // 空下标
+    static const uint32_t BASE = 1024;         // 第 0 个 slab 的节点数
+    static const int MAX_SLABS = 22;           // BASE * (2^22 - 1) 已接近 32 位下标上限
+
+    struct Node {
+        std::atomic<uint32_t> next;
+        alignas(T) unsigned char storage[sizeof(T)];
+        T* data() { return reinterpret_cast<T*>(storage); }
+    };
+
+    static uint64_t pack(uint32_t tag, uint32_t idx) { return ((uint64_t)tag << 32) | idx; }
+    static uint32_t idxOf(uint64_t v) { return (uint32_t)v; }
+    static uint32_t tagOf(uint64_t v) { return (uint32_t)(v >> 32); }
+
+    // 下标 i 位于第 k 个 slab，满足 BASE*(2^k - 1) <= i < BASE*(2^(k+1) - 1)
+    static int slabOf(uint32_t i) {
+        uint64_t q = (uint64_t)i / BASE + 1;
+        int k = 0;
+        while (q >>= 1) k++;
+        return k;
+    }
+    static uint32_t slabStart(int k) { return BASE * ((1u << k) - 1); }
+
+    alignas(64) std::atomic<uint64_t> _top;    // 栈顶：版本号 + 下标
+    alignas(64) std::atomic<uint64_t> _free;   // 空闲链表表头：版本号 + 下标
+    alignas(64) std::atomic<uint32_t> _bump;   // 下一个从未使用过的下标
+    alignas(64) std::atomic<long long> _size;  // 元素个数（近似值）
+    std::atomic<Node*> _slabs[MAX_SLABS];
+
+    Node* node(uint32_t i) const {
+        int k = slabOf(i);
+        return &_slabs[k].load(std::memory_order_acquire)[i - slabStart(k)];
+    }
+
+    // 确保第 k 个 slab 已分配；多个线程竞争时只有一个分配结果被采用
+    void ensureSlab(int k) {
+        if (_slabs[k].load(std::memory_order_acquire)) return;
+        std::size_t n = (std::size_t)BASE << k;
+        Node* fresh = static_cast<Node*>(::operator new(n * sizeof(Node)));
+        for (std::size_t j = 0; j < n; j++) ::new (&fresh[j].next) std::atomic<uint32_t>(NIL);
+        Node* expected = nullptr;
+        if (!_slabs[k].compare_exchange_strong(expected, fresh, std::memory_order_acq_rel))
+            ::operator delete(fresh);
+    }
+
+    // 无锁链表弹出（栈顶与空闲链表共用）
+    bool popIndex(std::atomic<uint64_t>& head, uint32_t& idx) {
+        uint64_t old = head.load(std::memory_order_acquire);
+        for (;;) {
+            uint32_t i = idxOf(old);
+            if (i == NIL) return false;
+            uint32_t next = node(i)->next.load(std::memory_order_relaxed);
+            if (head.compare_exchange_weak(old, pack(tagOf(old) + 1, next),
+                                           std::memory_order_acq_rel, std::memory_order_acquire)) {
+                idx = i;
+                return true;
+            }
+        }
+    }
+
+    // 无锁链表压入（栈顶与空闲链表共用）
+    void pushIndex(std::atomic<uint64_t>& head, uint32_t i) {
+        Node* n = node(i);
+        uint64_t old = head.load(std::memory_order_relaxed);
+        do {
+            n->next.store(idxOf(old), std::memory_order_relaxed);
+        } while (!head.compare_exchange_weak(old, pack(tagOf(old) + 1, i),
+                                             std::memory_order_acq_rel, std::memory_order_relaxed));
+    }
+
+    // 从节点池取一个节点：先取空闲链表，否则取新下标
+    // 新下标用 CAS 领取，池满时 _bump 停在上限不再增加，失败多少次都不会回绕到仍在使用的下标
+    uint32_t allocNode() {
+        uint32_t i;
+        if (popIndex(_free, i)) return i;
+        i = _bump.load(std::memory_order_relaxed);
+        do {
+            if (i >= slabStart(MAX_SLABS)) throw std::bad_alloc();
+        } while (!_bump.compare_exchange_weak(i, i + 1, std::memory_order_relaxed));
+        ensureSlab(slabOf(i));
+        return i;
+    }
+
+public:
+    ConcurrentStack() : _top(pack(0, NIL)), _free(pack(0, NIL)), _bump(0), _size(0) {
+        for (int k = 0; k < MAX_SLABS; k++) _slabs[k].store(nullptr, std::memory_order_relaxed);
+    }
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    // 析构时须已无其他线程访问
+    ~ConcurrentStack() {
+        uint32_t i;
+        while (popIndex(_top, i)) node(i)->data()->~T();
+        for (int k = 0; k < MAX_SLABS; k++)
+            ::operator delete(_slabs[k].load(std::memory_order_relaxed));
+    }
+
+    // 预先分配至少 n 个节点的池空间，避免运行期扩容
+    void reserve(uint32_t n) {
+        for (int k = 0; k < MAX_SLABS && slabStart(k) < n; k++) ensureSlab(k);
+    }
+
+    // 入栈操作
+    void push(const T& e) {
+        uint32_t i = allocNode();
+        ::new (node(i)->storage) T(e);
+        pushIndex(_top, i);
+        _size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 出栈操作：栈空时返回 false（并发环境下不抛出异常，由调用方决定如何等待）
+    bool pop(T& e) {
+        uint32_t i;
+        if (!popIndex(_top, i)) return false;
+        Node* n = node(i);
+        e = std::move(*n->data());
+        n->data()->~T();
+        pushIndex(_free, i);
+        _size.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // 判断栈是否为空（瞬时值）
+    bool empty() const { return idxOf(_top.load(std::memory_order_acquire)) == NIL; }
+    // 获取栈的大小（并发修改时为近似值）
+    long long size() const { return _size.load(std::memory_order_relaxed); }
+    // 节点池已分配的节点总数
+    uint32_t poolCapacity() const { return _bump.load(std::memory_order_relaxed); }
+};
+
+#endif // CONCURRENTSTACK_H
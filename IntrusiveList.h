@@ -0,0 +1,220 @@
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+
+typedef int Rank;
+
+// 侵入式双向链表：前驱、后继指针（ListHook）直接嵌在用户对象里，
+// 链表只负责把对象串起来，不分配节点、不复制对象，也不管理对象的生存期。
+// 已知对象指针时插入、删除均为 O(1) 且不分配内存，适合连接、定时器等对象。
+//
+// 用法：
+//   struct Conn {
+//       int fd;
+//       ListHook idle;       // 挂在空闲连接链表上
+//       ListHook byTimer;    // 同时挂在定时器链表上
+//   };
+//   IntrusiveList<Conn, &Conn::idle> idleList;
+//   IntrusiveList<Conn, &Conn::byTimer> timerList;
+// 一个对象有几个 ListHook 成员，就能同时位于几个链表中（每个钩子一个）。
+// 对象类型须为标准布局（与 offsetof 的要求相同），以便由钩子地址反推对象地址。
+//
+// 结构与 List 相同：头、尾哨兵（这里是链表对象内的两个钩子），位置即对象指针，
+// 越过首尾时返回 nullptr。对象离开链表时钩子被清空，可据 linked() 判断是否在链表中。
+//
+// 安全检查（INTRUSIVE_LIST_CHECKS，默认在未定义 NDEBUG 时打开）：钩子额外记录所属链表，
+// 重复插入、从别的链表删除时抛出 logic_error，仍在链表中的对象被析构时报错并终止。
+// 打开与关闭检查时钩子大小不同，同一程序的各编译单元须保持一致。
+
+#ifndef INTRUSIVE_LIST_CHECKS
+#ifdef NDEBUG
+#define INTRUSIVE_LIST_CHECKS 0
+#else
+#define INTRUSIVE_LIST_CHECKS 1
+#endif
+#endif
+
+// 链表钩子：嵌入对象中的前驱、后继指针
+struct ListHook {
+    ListHook* pred;   // 前驱钩子（未链入时为 nullptr）
+    ListHook* succ;   // 后继钩子
+#if INTRUSIVE_LIST_CHECKS
+    const void* owner;  // 所属链表
+#endif
+
+    ListHook() : pred(nullptr), succ(nullptr) {
+#if INTRUSIVE_LIST_CHECKS
+        owner = nullptr;
+#endif
+    }
+    // 复制对象不复制链表成员关系：副本的钩子总是未链入
+    ListHook(const ListHook&) : ListHook() {}
+    ListHook& operator=(const ListHook&) { return *this; }
+
+    ~ListHook() {
+#if INTRUSIVE_LIST_CHECKS
+        if (pred) {
+            std::fputs("IntrusiveList: object destroyed while still linked\n", stderr);
+            std::abort();
+        }
+#endif
+    }
+
+    // 是否位于某个链表中
+    bool linked() const { return pred != nullptr; }
+};
+
+template <typename T, ListHook T::*Hook>
+class IntrusiveList {
+private:
+    int _size;         // 链表中的对象数
+    ListHook header;   // 头哨兵
+    ListHook trailer;  // 尾哨兵
+
+    static ListHook* hookOf(T* x) { return &(x->*Hook); }
+
+    // 由钩子地址反推对象地址。钩子在对象中的偏移与 offsetof 同理，只对标准布局类型有意义；
+    // 首次调用时在一块静态存储上算出一次，此后每步只做一次减法，不再在栈上放置 T
+    static T* ownerOf(ListHook* h) {
+        static_assert(std::is_standard_layout<T>::value, "IntrusiveList requires a standard-layout T");
+        static const std::ptrdiff_t offset = [] {
+            alignas(T) static unsigned char storage[sizeof(T)];
+            const char* base = reinterpret_cast<const char*>(storage);
+            return reinterpret_cast<const char*>(&(reinterpret_cast<const T*>(storage)->*Hook)) - base;
+        }();
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(h) - offset);
+    }
+
+    void init() {
+        header.pred = nullptr;
+        header.succ = &trailer;
+        trailer.pred = &header;
+        trailer.succ = nullptr;
+        _size = 0;
+    }
+
+    // 把钩子 h 接到钩子 p 之前
+    T* link(ListHook* p, T* x) {
+        ListHook* h = hookOf(x);
+#if INTRUSIVE_LIST_CHECKS
+        if (h->pred) throw std::logic_error("IntrusiveList: object is already linked");
+        h->owner = this;
+#endif
+        h->pred = p->pred;
+        h->succ = p;
+        p->pred->succ = h;
+        p->pred = h;
+        _size++;
+        return x;
+    }
+
+    // 位置转换：哨兵对应 nullptr
+    T* at(ListHook* h) const {
+        return h == &header || h == &trailer ? nullptr : ownerOf(h);
+    }
+
+public:
+    IntrusiveList() { init(); }
+
+    // 移动构造：接管 L 中的全部对象，L 随后为空链表
+    IntrusiveList(IntrusiveList&& L) {
+        init();
+        splice(nullptr, L);
+    }
+
+    // 链表不拥有对象，复制没有意义
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    // 析构：把仍在链表中的对象全部摘下（对象本身不受影响）
+    ~IntrusiveList() {
+        clear();
+        trailer.pred = nullptr;  // 哨兵自身不算链入
+    }
+
+    Rank size() const { return _size; }
+    bool empty() const { return _size <= 0; }
+
+    // 首、末对象（空表时为 nullptr）
+    T* first() const { return at(header.succ); }
+    T* last() const { return at(trailer.pred); }
+
+    // 后继、前驱对象（越过首尾时为 nullptr）
+    T* succ(T* x) const { return at(hookOf(x)->succ); }
+    T* pred(T* x) const { return at(hookOf(x)->pred); }
+
+    // x 是否在本链表中（仅打开安全检查时可精确判断，否则只能判断是否在某个链表中）
+    bool contains(T* x) const {
+#if INTRUSIVE_LIST_CHECKS
+        return hookOf(x)->owner == this;
+#else
+        return hookOf(x)->linked();
+#endif
+    }
+
+    // 插入对象 x（x 须未链入本钩子对应的任何链表），返回 x
+    T* insertAsFirst(T* x) { return link(header.succ, x); }
+    T* insertAsLast(T* x) { return link(&trailer, x); }
+    T* insertA(T* p, T* x) { return link(hookOf(p)->succ, x); }  // 在 p 之后插入
+    T* insertB(T* p, T* x) { return link(hookOf(p), x); }         // 在 p 之前插入
+
+    // 从链表中摘下对象 x 并返回（不析构 x），O(1)
+    T* remove(T* x) {
+        ListHook* h = hookOf(x);
+#if INTRUSIVE_LIST_CHECKS
+        if (h->owner != this) throw std::logic_error("IntrusiveList: object is not in this list");
+        h->owner = nullptr;
+#endif
+        h->pred->succ = h->succ;
+        h->succ->pred = h->pred;
+        h->pred = h->succ = nullptr;  // 清空钩子，之后可再插入
+        _size--;
+        return x;
+    }
+
+    // 摘下首、末对象，空表时返回 nullptr
+    T* removeFirst() { return _size > 0 ? remove(first()) : nullptr; }
+    T* removeLast() { return _size > 0 ? remove(last()) : nullptr; }
+
+    // 接合：把 L 中的全部对象按原次序移到 p 之前（p 为 nullptr 时接到末尾），O(1)（安全检查时 O(n)）
+    void splice(T* p, IntrusiveList& L) {
+        if (L._size == 0 || &L == this) return;
+        ListHook* pos = p ? hookOf(p) : &trailer;
+        ListHook* f = L.header.succ;
+        ListHook* l = L.trailer.pred;
+#if INTRUSIVE_LIST_CHECKS
+        for (ListHook* h = f; h != &L.trailer; h = h->succ) h->owner = this;
+#endif
+        f->pred = pos->pred;
+        l->succ = pos;
+        pos->pred->succ = f;
+        pos->pred = l;
+        _size += L._size;
+        L.init();
+    }
+
+    // 清空：摘下全部对象，返回摘下的个数
+    int clear() {
+        int oldSize = _size;
+        while (_size > 0) remove(first());
+        return oldSize;
+    }
+
+    // 遍历（函数指针版本）：对每个对象执行 visit
+    void traverse(void (*visit)(T&)) {
+        for (ListHook* h = header.succ; h != &trailer; h = h->succ) visit(*ownerOf(h));
+    }
+
+    // 遍历（函数对象版本）
+    template <typename VST>
+    void traverse(VST& visit) {
+        for (ListHook* h = header.succ; h != &trailer; h = h->succ) visit(*ownerOf(h));
+    }
+};
+
+#endif // INTRUSIVELIST_H
@@ -0,0 +1,431 @@
+#ifndef LRUCACHE_H
+#define LRUCACHE_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "List.h"
+
+// 进程内缓存：条目存放在 List 的节点中，按访问顺序排列；另用开放定址散列表
+// 从关键码直接找到节点（ListNodePosi），命中后用 splice 把节点挪到新位置，
+// 查找、插入、淘汰均为 O(1)，节点挪动不分配内存，散列表中的节点位置始终有效。
+//
+// 淘汰策略（CachePolicy）：
+//   CACHE_LRU   淘汰最久未访问的条目
+//   CACHE_SLRU  分段 LRU：新条目进入试用段，再次命中才升入保护段（占容量的 4/5），
+//               保护段满时把其中最久未访问的条目降回试用段；优先从试用段淘汰，
+//               一次性扫描不会冲掉反复访问的热点
+//   CACHE_LFU   淘汰访问次数最少的条目，次数相同时淘汰最久未访问的。
+//               链表按次数升序排列，记下每个次数段的末节点，命中时节点只需挪到下一段末尾
+//
+// 容量单位（CacheUnit）：CACHE_ENTRIES 按条目数，CACHE_BYTES 按字节数
+// （put 时给出条目字节数，未给出时按 sizeof(K) + sizeof(V) 计）。
+// LRUCache 本身不加锁；多线程共用时使用 ShardedLRUCache。
+
+enum CachePolicy { CACHE_LRU, CACHE_SLRU, CACHE_LFU };
+enum CacheUnit { CACHE_ENTRIES, CACHE_BYTES };
+
+// 缓存统计
+struct CacheStats {
+    long long hits;        // 命中次数
+    long long misses;      // 未命中次数
+    long long insertions;  // 新插入的条目数
+    long long evictions;   // 因容量不足被淘汰的条目数
+    size_t entries;        // 当前条目数
+    size_t used;           // 当前占用（条目数或字节数，与容量单位一致）
+};
+
+// 缓存条目（List 节点中的数据）
+template <typename K, typename V>
+struct LRUEntry {
+    K key;
+    V value;
+    size_t charge;      // 按容量单位计的占用
+    long long freq;     // 访问次数（LFU）
+    int segment;        // 所在链表：0 为主链表/试用段，1 为保护段（SLRU）
+
+    LRUEntry() : charge(0), freq(0), segment(0) {}  // 供哨兵节点使用
+    template <typename VV>
+    LRUEntry(K const& k, VV&& v, size_t c)
+        : key(k), value(std::forward<VV>(v)), charge(c), freq(1), segment(0) {}
+};
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class LRUCache {
+public:
+    typedef LRUEntry<K, V> Entry;
+    typedef ListNodePosi<Entry> Posi;
+
+private:
+    // 散列表槽位：node 为空表示空槽；hash 缓存完整散列值，探测时先比它再比关键码
+    struct Slot {
+        Posi node;
+        size_t hash;
+    };
+
+    CachePolicy _policy;
+    CacheUnit _unit;
+    size_t _capacity;               // 总容量
+    size_t _used;                   // 当前占用
+    size_t _protectedUsed;          // 保护段占用（SLRU）
+    List<Entry> _list[2];           // 0：主链表/试用段，1：保护段；表头为最近访问
+    std::unordered_map<long long, Posi> _tails;  // LFU：访问次数 -> 该次数段的末节点
+    std::vector<Slot> _slots;            // 开放定址（线性探测）散列表，容量为 2 的幂
+    size_t _count;                  // 散列表中的条目数
+    CacheStats _stats;
+    Hash _hash;
+
+    // ---------- 散列索引 ----------
+
+    // 打散散列值：std::hash 对整数是恒等映射，连续的关键码会在线性探测中连成长串
+    size_t hashOf(K const& key) const {
+        unsigned long long h = (unsigned long long)_hash(key);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        return (size_t)h;
+    }
+
+    // 查找 key 所在槽位，不存在时返回 -1
+    long long slotOf(K const& key, size_t h) const {
+        if (_slots.empty()) return -1;
+        size_t mask = _slots.size() - 1;
+        for (size_t i = h & mask; _slots[i].node; i = (i + 1) & mask)
+            if (_slots[i].hash == h && _slots[i].node->data.key == key) return (long long)i;
+        return -1;
+    }
+
+    void place(Posi node, size_t h) {
+        size_t mask = _slots.size() - 1;
+        size_t i = h & mask;
+        while (_slots[i].node) i = (i + 1) & mask;
+        _slots[i].node = node;
+        _slots[i].hash = h;
+    }
+
+    // 装载率超过 3/4 时容量翻倍并重新放置
+    void indexInsert(Posi node, size_t h) {
+        if ((_count + 1) * 4 > _slots.size() * 3) {
+            std::vector<Slot> old;
+            old.swap(_slots);
+            _slots.assign(old.empty() ? 16 : old.size() * 2, Slot{ nullptr, 0 });
+            for (size_t i = 0; i < old.size(); i++)
+                if (old[i].node) place(old[i].node, old[i].hash);
+        }
+        place(node, h);
+        _count++;
+    }
+
+    // 删除槽位 i：把其后同一探测序列上的条目逐个前移填补空位（backward shift），不留墓碑
+    void indexErase(size_t i) {
+        size_t mask = _slots.size() - 1;
+        size_t j = i;
+        while (true) {
+            j = (j + 1) & mask;
+            if (!_slots[j].node) break;
+            size_t home = _slots[j].hash & mask;
+            // home 循环地落在 (i, j] 内时，j 处的条目无需移动
+            bool stay = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+            if (stay) continue;
+            _slots[i] = _slots[j];
+            i = j;
+        }
+        _slots[i].node = nullptr;
+        _count--;
+    }
+
+    // ---------- 链表位置 ----------
+
+    // LFU：x 即将离开原位置，若它是本次数段的末节点则改记其前驱（前驱不同段时删去该段）
+    void lfuDetach(Posi x) {
+        auto it = _tails.find(x->data.freq);
+        if (it == _tails.end() || it->second != x) return;
+        List<Entry>& L = _list[0];
+        Posi p = x->pred;
+        if (L.valid(p) && p->data.freq == x->data.freq) it->second = p;
+        else _tails.erase(it);
+    }
+
+    // 保护段容量：总容量的 4/5（按 floor(4c/5) 分项计算以免溢出），至少为 1，
+    // 否则容量不足 5 时每次升级都会把保护段中原有的条目立即降级
+    size_t protectedCapacity() const {
+        size_t cap = _capacity / 5 * 4 + _capacity % 5 * 4 / 5;
+        return cap > 0 ? cap : 1;
+    }
+
+    // 命中（或更新）后调整 x 的位置
+    void touch(Posi x) {
+        Entry& e = x->data;
+        if (_policy == CACHE_LRU) {
+            List<Entry>& L = _list[0];
+            if (x != L.first()) L.splice(L.first(), L, x);
+        } else if (_policy == CACHE_SLRU) {
+            List<Entry>& P = _list[1];
+            if (e.segment == 0) {  // 试用段再次命中：升入保护段
+                P.splice(P.first(), _list[0], x);
+                e.segment = 1;
+                _protectedUsed += e.charge;
+                while (_protectedUsed > protectedCapacity() && P.size() > 1) {  // 保护段超额：降级
+                    Posi y = P.last();
+                    _protectedUsed -= y->data.charge;
+                    y->data.segment = 0;
+                    _list[0].splice(_list[0].first(), P, y);
+                }
+            } else if (x != P.first()) {
+                P.splice(P.first(), P, x);
+            }
+        } else {  // LFU：挪到下一次数段的末尾
+            List<Entry>& L = _list[0];
+            auto next = _tails.find(e.freq + 1);
+            Posi target = next != _tails.end() ? next->second : _tails[e.freq];
+            lfuDetach(x);
+            if (target != x) L.splice(target->succ, L, x);
+            e.freq++;
+            _tails[e.freq] = x;
+        }
+    }
+
+    // 链入新节点
+    Posi link(K const& key, V const& value, size_t charge) { return linkEntry(key, value, charge); }
+    Posi link(K const& key, V&& value, size_t charge) { return linkEntry(key, std::move(value), charge); }
+
+    template <typename VV>
+    Posi linkEntry(K const& key, VV&& value, size_t charge) {
+        List<Entry>& L = _list[0];
+        if (_policy != CACHE_LFU) return L.emplaceAsFirst(key, std::forward<VV>(value), charge);
+        auto it = _tails.find(1);
+        Posi x = it != _tails.end() ? L.emplaceA(it->second, key, std::forward<VV>(value), charge)
+                                    : L.emplaceAsFirst(key, std::forward<VV>(value), charge);
+        _tails[1] = x;
+        return x;
+    }
+
+    // 摘下并释放节点 x（散列索引由调用者处理）
+    void unlink(Posi x) {
+        Entry& e = x->data;
+        _used -= e.charge;
+        if (e.segment == 1) _protectedUsed -= e.charge;
+        if (_policy == CACHE_LFU) lfuDetach(x);
+        _list[e.segment].remove(x);
+    }
+
+    // 淘汰候选：LRU/SLRU 为（试用段）最久未访问者，LFU 为次数最少者中最久未访问的
+    Posi victim() const {
+        if (_policy == CACHE_LFU) return _list[0].first();
+        return _list[0].empty() ? _list[1].last() : _list[0].last();
+    }
+
+    void evict() {
+        while (_used > _capacity && _count > 0) {
+            Posi x = victim();
+            indexErase((size_t)slotOf(x->data.key, hashOf(x->data.key)));
+            unlink(x);
+            _stats.evictions++;
+        }
+    }
+
+    size_t chargeOf(size_t bytes) const {
+        if (_unit == CACHE_ENTRIES) return 1;
+        return bytes ? bytes : sizeof(K) + sizeof(V);
+    }
+
+    template <typename VV>
+    void putValue(K const& key, VV&& value, size_t bytes) {
+        size_t h = hashOf(key);
+        size_t charge = chargeOf(bytes);
+        long long i = slotOf(key, h);
+        if (i >= 0) {  // 已存在：更新值与占用，视为一次访问
+            Posi x = _slots[(size_t)i].node;
+            x->data.value = std::forward<VV>(value);
+            _used += charge - x->data.charge;
+            if (x->data.segment == 1) _protectedUsed += charge - x->data.charge;
+            x->data.charge = charge;
+            touch(x);
+        } else {
+            if (charge > _capacity) return;  // 单个条目超过总容量，不缓存
+            _used += charge;
+            indexInsert(link(key, std::forward<VV>(value), charge), h);
+            _stats.insertions++;
+        }
+        evict();
+    }
+
+public:
+    explicit LRUCache(size_t capacity, CachePolicy policy = CACHE_LRU, CacheUnit unit = CACHE_ENTRIES)
+        : _policy(policy), _unit(unit), _capacity(capacity), _used(0), _protectedUsed(0), _count(0) {
+        resetStats();
+    }
+
+    LRUCache(const LRUCache&) = delete;
+    LRUCache& operator=(const LRUCache&) = delete;
+
+    // 查找 key：命中时把值复制到 out 并返回 true
+    bool get(K const& key, V& out) {
+        V* v = find(key);
+        if (!v) return false;
+        out = *v;
+        return true;
+    }
+
+    // 查找 key：命中时返回缓存中值的指针（下次修改缓存前有效），否则返回 nullptr
+    V* find(K const& key) {
+        long long i = slotOf(key, hashOf(key));
+        if (i < 0) {
+            _stats.misses++;
+            return nullptr;
+        }
+        _stats.hits++;
+        Posi x = _slots[(size_t)i].node;
+        touch(x);
+        return &x->data.value;
+    }
+
+    // 是否缓存了 key（不算访问，不影响统计与淘汰顺序）
+    bool contains(K const& key) const { return slotOf(key, hashOf(key)) >= 0; }
+
+    // 插入或更新；bytes 为按字节计容量时该条目的大小（0 表示 sizeof(K) + sizeof(V)）
+    void put(K const& key, V const& value, size_t bytes = 0) { putValue(key, value, bytes); }
+    void put(K const& key, V&& value, size_t bytes = 0) { putValue(key, std::move(value), bytes); }
+
+    // 删除 key，成功返回 true
+    bool erase(K const& key) {
+        long long i = slotOf(key, hashOf(key));
+        if (i < 0) return false;
+        Posi x = _slots[(size_t)i].node;
+        indexErase((size_t)i);
+        unlink(x);
+        return true;
+    }
+
+    // 清空全部条目（统计保留）
+    void clear() {
+        while (_count > 0) {
+            Posi x = victim();
+            indexErase((size_t)slotOf(x->data.key, hashOf(x->data.key)));
+            unlink(x);
+        }
+    }
+
+    // 调整容量，必要时立即淘汰
+    void setCapacity(size_t capacity) {
+        _capacity = capacity;
+        evict();
+    }
+
+    size_t size() const { return _count; }
+    size_t used() const { return _used; }
+    size_t capacity() const { return _capacity; }
+    CachePolicy policy() const { return _policy; }
+
+    CacheStats stats() const {
+        CacheStats s = _stats;
+        s.entries = _count;
+        s.used = _used;
+        return s;
+    }
+    void resetStats() { _stats = CacheStats{ 0, 0, 0, 0, 0, 0 }; }
+
+    // 按淘汰的反序（最不容易被淘汰的在前）遍历条目
+    template <typename VST>
+    void traverse(VST& visit) {
+        if (_policy == CACHE_LFU) {
+            for (Posi p = _list[0].last(); _list[0].valid(p); p = p->pred) visit(p->data.key, p->data.value);
+            return;
+        }
+        for (int s = 1; s >= 0; s--)
+            for (Posi p = _list[s].first(); _list[s].valid(p); p = p->succ) visit(p->data.key, p->data.value);
+    }
+};
+
+// 分片缓存：按关键码散列到若干个各自带锁的 LRUCache，不同分片上的操作互不阻塞。
+// 容量均分到各分片，因此淘汰顺序是分片内的近似全局顺序
+template <typename K, typename V, typename Hash = std::hash<K>>
+class ShardedLRUCache {
+private:
+    struct Shard {
+        std::mutex lock;
+        LRUCache<K, V, Hash> cache;
+        Shard(size_t capacity, CachePolicy policy, CacheUnit unit) : cache(capacity, policy, unit) {}
+    };
+    std::vector<std::unique_ptr<Shard>> _shards;
+    Hash _hash;
+
+    // 用散列值的高位选分片，分片内的散列表用低位，二者互不相关
+    Shard& shardOf(K const& key) {
+        unsigned long long h = (unsigned long long)_hash(key) * 0x9E3779B97F4A7C15ull;
+        return *_shards[(size_t)((h >> 32) % _shards.size())];
+    }
+
+public:
+    // shards 为分片数（默认 16），容量小于分片数时减少分片，使每个分片至少能放下 1 个单位
+    // 各分片容量为 capacity / shards，余数分给前几个分片，总和恰为 capacity
+    explicit ShardedLRUCache(size_t capacity, CachePolicy policy = CACHE_LRU,
+                             CacheUnit unit = CACHE_ENTRIES, int shards = 16) {
+        if (shards < 1) shards = 1;
+        if ((size_t)shards > capacity) shards = capacity > 0 ? (int)capacity : 1;
+        size_t per = capacity / shards, extra = capacity % shards;
+        for (int i = 0; i < shards; i++)
+            _shards.emplace_back(new Shard(per + ((size_t)i < extra ? 1 : 0), policy, unit));
+    }
+
+    bool get(K const& key, V& out) {
+        Shard& s = shardOf(key);
+        std::lock_guard<std::mutex> g(s.lock);
+        return s.cache.get(key, out);
+    }
+
+    bool contains(K const& key) {
+        Shard& s = shardOf(key);
+        std::lock_guard<std::mutex> g(s.lock);
+        return s.cache.contains(key);
+    }
+
+    void put(K const& key, V const& value, size_t bytes = 0) {
+        Shard& s = shardOf(key);
+        std::lock_guard<std::mutex> g(s.lock);
+        s.cache.put(key, value, bytes);
+    }
+
+    void put(K const& key, V&& value, size_t bytes = 0) {
+        Shard& s = shardOf(key);
+        std::lock_guard<std::mutex> g(s.lock);
+        s.cache.put(key, std::move(value), bytes);
+    }
+
+    bool erase(K const& key) {
+        Shard& s = shardOf(key);
+        std::lock_guard<std::mutex> g(s.lock);
+        return s.cache.erase(key);
+    }
+
+    void clear() {
+        for (auto& s : _shards) {
+            std::lock_guard<std::mutex> g(s->lock);
+            s->cache.clear();
+        }
+    }
+
+    int shardCount() const { return (int)_shards.size(); }
+
+    // 汇总各分片的统计（逐个加锁读取，不是同一时刻的快照）
+    CacheStats stats() {
+        CacheStats t = { 0, 0, 0, 0, 0, 0 };
+        for (auto& s : _shards) {
+            std::lock_guard<std::mutex> g(s->lock);
+            CacheStats c = s->cache.stats();
+            t.hits += c.hits;
+            t.misses += c.misses;
+            t.insertions += c.insertions;
+            t.evictions += c.evictions;
+            t.entries += c.entries;
+            t.used += c.used;
+        }
+        return t;
+    }
+};
+
+#endif // LRUCACHE_H
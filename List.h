@@ -1,5 +1,15 @@
+#ifndef LIST_H
+#define LIST_H
+
 #include <iostream>
-#include <cstdlib>  // 用于 rand() 函数（排序时随机选择算法）
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "NodePool.h"
 using namespace std;
 
 // 定义秩（Rank）：用于表示链表中节点的位置索引（类似数组下标）
@@ -13,9 +23,17 @@ struct ListNode {
     ListNode<T>* succ;    // 指向后继节点的指针
 
     // 节点构造函数
-    // 参数：e（数据）、p（前驱指针）、s（后继指针），均有默认值
-    ListNode(T e = T(), ListNode<T>* p = nullptr, ListNode<T>* s = nullptr)
+    // 参数：e（数据）、p（前驱指针）、s（后继指针）；数据可复制或移动进来
+    ListNode() : data(), pred(nullptr), succ(nullptr) {}
+    ListNode(T const& e, ListNode<T>* p = nullptr, ListNode<T>* s = nullptr)
         : data(e), pred(p), succ(s) {}
+    ListNode(T&& e, ListNode<T>* p = nullptr, ListNode<T>* s = nullptr)
+        : data(std::move(e)), pred(p), succ(s) {}
+
+    // 就地构造：以 args 直接构造数据（piecewise_construct 仅用于区分重载）
+    template <typename... Args>
+    ListNode(std::piecewise_construct_t, ListNode<T>* p, ListNode<T>* s, Args&&... args)
+        : data(std::forward<Args>(args)...), pred(p), succ(s) {}
 };
 
 // 定义节点位置的别名：简化 ListNode<T>* 的书写
@@ -23,27 +41,132 @@ struct ListNode {
 template <typename T> 
 using ListNodePosi = ListNode<T>*;
 
+// 判断 T 能否用 std::hash 散列（deduplicate 据此选择算法）
+template <typename T, typename = void>
+struct ListHashable : std::false_type {};
+template <typename T>
+struct ListHashable<T, decltype((void)std::hash<T>()(std::declval<T const&>()))> : std::true_type {};
+
+// 按指针所指的元素散列与判等，散列集合中只存元素地址，不复制元素
+template <typename T>
+struct ListDerefHash {
+    size_t operator()(const T* p) const { return std::hash<T>()(*p); }
+};
+template <typename T>
+struct ListDerefEqual {
+    bool operator()(const T* a, const T* b) const { return *a == *b; }
+};
+
+// 排序策略：sort() 根据区间长度与相邻逆序对数选择
+enum ListSortStrategy {
+    LIST_SORT_NONE,             // 已有序，未做任何移动
+    LIST_SORT_INSERTION,        // 插入排序
+    LIST_SORT_INSERTION_MERGE,  // 插入排序超出步数上限，转归并排序完成
+    LIST_SORT_MERGE             // 归并排序
+};
+
+// 一次 sort() 调用的统计信息，排序结束后交给排序钩子
+struct ListSortStats {
+    ListSortStrategy strategy;
+    int n;             // 区间长度
+    int inversions;    // 排序前的相邻逆序对数
+    double scanMs;     // 统计逆序对用时（毫秒）
+    double sortMs;     // 排序用时（毫秒）
+};
+
+typedef void (*ListSortHook)(const ListSortStats&);
+
+const int LIST_INSERTION_MAX = 16;    // 不超过此长度时直接用插入排序
+const int LIST_NEARLY_SORTED = 64;    // 逆序对数不超过 n / 64 视为几乎有序
+const int LIST_INSERTION_STEPS = 8;   // 插入排序的比较步数上限为 8n
+
+// 并行排序另见 ListParallel.h（需要线程池，不随链表本身引入）
+class ForkJoinPool;
+template <typename T, template <typename> class Alloc> class List;
+template <typename T, template <typename> class Alloc>
+void parallelSort(List<T, Alloc>& L, ForkJoinPool& pool);
+
 // 双向链表类模板（带哨兵节点，简化边界处理）
-template <typename T> 
+// Alloc 为节点分配策略（见 NodePool.h），默认逐个 new/delete，
+// 取 PoolAlloc 时节点（含哨兵）来自节点池，clear() 整块归还内存
+template <typename T, template <typename> class Alloc = HeapAlloc> 
 class List {
 private:
+    friend void parallelSort<>(List<T, Alloc>& L, ForkJoinPool& pool);  // 直接使用 sortChain 与哨兵
+
     int _size;               // 链表实际节点数量（不包含哨兵）
     ListNodePosi<T> header;  // 头哨兵节点（不存储数据，简化头部操作）
     ListNodePosi<T> trailer; // 尾哨兵节点（不存储数据，简化尾部操作）
+    Alloc<ListNode<T>> _alloc; // 节点分配器
+    ListSortHook _sortHook = nullptr;  // 排序钩子（为空时不计时）
+    // 手指：最近一次按秩访问的（秩, 节点），按秩定位时可从这里出发；为空表示失效。
+    // const 的按秩访问也会更新手指，因此同一链表不能在多个线程中同时按秩读取
+    mutable ListNodePosi<T> _finger = nullptr;
+    mutable Rank _fingerRank = 0;
+
+    // 释放全部节点（含哨兵）：逐个析构后交由分配器回收；
+    // 池化分配且元素为平凡析构类型时跳过遍历，直接整块归还
+    void destroyAll() {
+        if (!(Alloc<ListNode<T>>::bulkRelease && std::is_trivially_destructible<T>::value)) {
+            ListNodePosi<T> p = header->succ;
+            for (int i = 0; i < _size; i++) {
+                ListNodePosi<T> next = p->succ;
+                _alloc.destroy(p);
+                p = next;
+            }
+            _alloc.destroy(header);
+            _alloc.destroy(trailer);
+        }
+        _alloc.release();
+    }
 
 protected:
     // 初始化链表：创建哨兵节点并建立初始连接
     void init() {
-        header = new ListNode<T>();  // 创建头哨兵（默认构造）
-        trailer = new ListNode<T>(); // 创建尾哨兵（默认构造）
+        header = _alloc.create();    // 创建头哨兵（默认构造）
+        trailer = _alloc.create();   // 创建尾哨兵（默认构造）
         header->succ = trailer;      // 头哨兵的后继指向尾哨兵
         trailer->pred = header;      // 尾哨兵的前驱指向头哨兵
         _size = 0;                   // 初始长度为 0
+        _finger = nullptr;
+    }
+
+    // 定位秩为 r 的节点（-1 为头哨兵，_size 为尾哨兵）：
+    // 从头哨兵、尾哨兵与 (r0, p0) 三者中最近的一处出发走过去，p0 为空时不考虑
+    ListNodePosi<T> locate(Rank r, ListNodePosi<T> p0, Rank r0) const {
+        ListNodePosi<T> p = header;
+        Rank from = -1;
+        if (_size - r < r + 1) { p = trailer; from = _size; }
+        if (p0 && abs(r - r0) < abs(r - from)) { p = p0; from = r0; }
+        for (; from < r; from++) p = p->succ;
+        for (; from > r; from--) p = p->pred;
+        return p;
+    }
+
+    // 插入新节点 x 后维护手指：能判断 x 在手指之前或之后时修正秩，否则令手指失效
+    void fingerInserted(ListNodePosi<T> x) {
+        if (!_finger) return;
+        if (x->succ == _finger || x->pred == header) _fingerRank++;
+        else if (x->pred != _finger && x->succ != trailer) _finger = nullptr;
+    }
+
+    // 删除节点 p 之前维护手指：删的正是手指时移到其后继（秩不变）
+    void fingerRemoving(ListNodePosi<T> p) {
+        if (!_finger) return;
+        if (p == _finger) _finger = p->succ != trailer ? p->succ : nullptr;
+        else if (p->pred == header) _fingerRank--;
+        else if (p->succ != trailer) _finger = nullptr;
     }
 
     // 清空链表：删除所有实际节点（保留哨兵）
+    // 池化分配时整体释放后重建哨兵，不再逐个删除
     int clear() {
         int oldSize = _size;         // 记录原始长度
+        if (Alloc<ListNode<T>>::bulkRelease) {
+            destroyAll();
+            init();
+            return oldSize;
+        }
         while (_size > 0) {
             remove(header->succ);    // 从第一个实际节点开始删除
         }
@@ -59,42 +182,143 @@ protected:
         }
     }
 
+    // 摘下节点 q 并接到节点 p 之前（只改指针，不分配内存）
+    static void relinkBefore(ListNodePosi<T> p, ListNodePosi<T> q) {
+        q->pred->succ = q->succ;
+        q->succ->pred = q->pred;
+        q->pred = p->pred;
+        q->succ = p;
+        p->pred->succ = q;
+        p->pred = q;
+    }
+
     // 归并算法：将当前链表中 p 开始的 n 个节点与 L 中 q 开始的 m 个节点归并
-    // 前提：两部分都是有序的，归并后整体有序
-    void merge(ListNodePosi<T>& p, int n, List<T>& L, ListNodePosi<T> q, int m) {
+    // 前提：两部分都是有序的，归并后整体有序；相等元素中本链表的在前（稳定，只用 <）
+    // L 的节点经 splice 接入，不分配内存；L 为本链表时 q 段须紧接在 p 段之后
+    void merge(ListNodePosi<T>& p, int n, List<T, Alloc>& L, ListNodePosi<T> q, int m) {
         ListNodePosi<T> pp = p->pred;  // 记录 p 的前驱（用于归并后连接）
-        while (m > 0 && n > 0) {       // 两边都有节点时循环
-            // 取较小的节点插入到当前链表
+        while (m > 0 && n > 0) {
             if (q->data < p->data) {
-                insertB(p, L.remove(q));  // 将 L 中 q 节点移到 p 之前
-                q = L.first();            // 更新 q 为 L 的新首节点
+                ListNodePosi<T> next = q->succ;  // 提前记录下一个节点
+                splice(p, L, q);                 // q 较小：移到 p 之前
+                q = next;
                 m--;
             } else {
-                p = p->succ;  // 当前节点较小，直接后移
+                p = p->succ;  // 当前节点不大于 q，直接后移
                 n--;
             }
         }
-        // 若 L 中还有剩余节点，全部插入当前链表
-        if (m > 0) {
-            while (m-- > 0) {
-                ListNodePosi<T> next = q->succ;  // 提前记录下一个节点
-                insertB(p, L.remove(q));
-                q = next;
+        if (m > 0 && p != q) {  // 本段已取完：L 中剩余的 m 个节点整段接到末尾
+            ListNodePosi<T> end = q;
+            for (int i = 0; i < m; i++) end = end->succ;
+            splice(p, L, q, end, m);
+        }
+        p = pp->succ;  // p 指向归并后的首节点
+    }
+
+    // 去重（可散列）：从后向前扫描，散列集合中已有相等元素的节点即为重复，期望 O(n)
+    int deduplicate(std::true_type) {
+        int oldSize = _size;
+        unordered_set<const T*, ListDerefHash<T>, ListDerefEqual<T>> seen;
+        seen.reserve(_size);
+        for (ListNodePosi<T> p = last(); p != header; ) {
+            ListNodePosi<T> pred = p->pred;
+            if (!seen.insert(&p->data).second) remove(p);
+            p = pred;
+        }
+        return oldSize - _size;
+    }
+
+    // 去重（不可散列）：在 p 之前的 r 个不重复节点中查找与 p 相等者并删除，O(n^2)
+    int deduplicate(std::false_type) {
+        int oldSize = _size;
+        Rank r = 0;
+        for (ListNodePosi<T> p = first(); p != trailer; p = p->succ) {
+            ListNodePosi<T> q = find(p->data, r, p);
+            if (q) remove(q);  // 有重复则删除前面的那个
+            else r++;          // 否则前面的不重复区间加长
+        }
+        return oldSize - _size;
+    }
+
+    // 稳定归并两条以 nullptr 结尾的单向链（只沿 succ），相等时取 a 中的节点
+    static ListNodePosi<T> mergeChains(ListNodePosi<T> a, ListNodePosi<T> b) {
+        ListNodePosi<T> head = nullptr;
+        ListNodePosi<T>* tail = &head;
+        while (a && b) {
+            if (b->data < a->data) { *tail = b; tail = &b->succ; b = b->succ; }
+            else                   { *tail = a; tail = &a->succ; a = a->succ; }
+        }
+        *tail = a ? a : b;
+        return head;
+    }
+
+    // 有序链排序：把从 cur 开始沿 succ 的 n 个节点排成以 nullptr 结尾的有序链并返回其首节点，
+    // cur 随之移到这 n 个节点之后（只读取该位置，不访问其后的节点，供并行排序分块使用）。
+    // 自底向上、稳定、只比较 <：一遍扫描切出自然有序段（严格递减的段原地反转），
+    // 按二进制计数的方式逐级归并：slot[k] 存放由 2^k 个自然段归并成的有序链，
+    // 新段与之归并后进位到 slot[k+1]。只重接 succ 指针，不分配、不释放节点
+    static ListNodePosi<T> sortChain(ListNodePosi<T>& cur, int n) {
+        ListNodePosi<T> slot[64] = {};
+        while (n > 0) {
+            // 切出从 cur 开始的自然段
+            ListNodePosi<T> run = cur, tail = cur;
+            cur = cur->succ;
+            n--;
+            if (n > 0 && cur->data < tail->data) {  // 严格递减：边取边反转
+                run->succ = nullptr;
+                while (n > 0 && cur->data < run->data) {
+                    ListNodePosi<T> next = cur->succ;
+                    cur->succ = run;
+                    run = cur;
+                    cur = next;
+                    n--;
+                }
+            } else {                                // 非递减
+                while (n > 0 && !(cur->data < tail->data)) {
+                    tail = cur;
+                    cur = cur->succ;
+                    n--;
+                }
+                tail->succ = nullptr;
+            }
+            // 逐级进位：较早的（左侧）链在前，保证稳定
+            int k = 0;
+            while (slot[k]) {
+                run = mergeChains(slot[k], run);
+                slot[k++] = nullptr;
             }
+            slot[k] = run;
         }
-        _size += m;    // 更新当前链表长度（此时 m 已为 0，不影响）
-        L._size -= m;  // 更新 L 的长度
+        // 从低到高合并剩余各级，高位的链位于左侧
+        ListNodePosi<T> result = nullptr;
+        for (int k = 0; k < 64; k++) {
+            if (slot[k]) result = result ? mergeChains(slot[k], result) : slot[k];
+        }
+        return result;
     }
 
-    // 归并排序：对 p 开始的 n 个节点进行排序（分治思想）
+    // 把有序链 chain 接在 before 与 after 之间，沿途恢复 pred 指针
+    static void attachChain(ListNodePosi<T> before, ListNodePosi<T> chain, ListNodePosi<T> after) {
+        ListNodePosi<T> prev = before;
+        for (ListNodePosi<T> x = chain; x; x = x->succ) {
+            prev->succ = x;
+            x->pred = prev;
+            prev = x;
+        }
+        prev->succ = after;
+        after->pred = prev;
+    }
+
+    // 归并排序：对 p 开始的 n 个节点排序（自底向上、稳定、只比较 <，见 sortChain）
+    // 排序只重接 pred/succ 指针，不分配、不释放节点，也不再逐层走到中点
     void mergeSort(ListNodePosi<T> p, int n) {
         if (n < 2) return;  // 单个节点无需排序
-        int mid = n >> 1;   // 取中点（等价于 n/2，效率更高）
-        ListNodePosi<T> q = p;
-        for (int i = 0; i < mid; i++) q = q->succ;  // 找到后半段起点
-        mergeSort(p, mid);         // 递归排序前半段
-        mergeSort(q, n - mid);     // 递归排序后半段
-        merge(p, mid, *this, q, n - mid);  // 归并两段
+        _finger = nullptr;
+        ListNodePosi<T> before = p->pred;
+        ListNodePosi<T> cur = p;
+        ListNodePosi<T> chain = sortChain(cur, n);
+        attachChain(before, chain, cur);  // cur 此时为区间之后的节点
     }
 
     // 选择排序：对 p 开始的 n 个节点进行排序（每次选最大元素放尾部）
@@ -112,13 +336,26 @@ protected:
     }
 
     // 插入排序：对 p 开始的 n 个节点进行排序（逐个插入到前面的有序区间）
-    void insertionSort(ListNodePosi<T> p, int n) {
-        for (int i = 0; i < n; i++) {
-            // 找到插入位置并插入当前节点数据
-            insertA(search(p->data, i, p), p->data);
-            p = p->succ;       // 处理下一个节点
-            remove(p->pred);   // 删除原位置的节点
+    // 节点直接摘下接到插入位置，不分配内存；只比较 <，相等元素保持原次序。
+    // steps 限制向前比较的总步数（负数表示不限），用完时停下返回 false，
+    // 此时区间仍是原区间的一个排列，可交给归并排序继续完成
+    bool insertionSort(ListNodePosi<T> p, int n, long long steps = -1) {
+        if (n < 2) return true;
+        _finger = nullptr;
+        ListNodePosi<T> x = p->succ;
+        for (int i = 1; i < n; i++) {
+            ListNodePosi<T> next = x->succ;  // 提前记录下一个待插入节点
+            ListNodePosi<T> q = x->pred;
+            int k = i;                       // 有序前缀中尚未比较的节点数
+            while (k > 0 && x->data < q->data) {
+                if (steps >= 0 && steps-- == 0) return false;
+                q = q->pred;
+                k--;
+            }
+            if (q != x->pred) relinkBefore(q->succ, x);  // 插到 q 之后
+            x = next;
         }
+        return true;
     }
 
 public:
@@ -126,39 +363,103 @@ public:
     List() { init(); }
 
     // 复制构造函数：复制整个链表 L
-    List(List<T> const& L) { copyNodes(L.first(), L._size); }
+    List(List<T, Alloc> const& L) { copyNodes(L.first(), L._size); }
 
     // 部分复制构造：复制 L 中从秩 r 开始的 n 个节点
-    List(List<T> const& L, Rank r, int n) {
-        ListNodePosi<T> p = L.first();
-        for (int i = 0; i < r; i++) p = p->succ;  // 移动到秩 r 对应的节点
-        copyNodes(p, n);
-    }
+    List(List<T, Alloc> const& L, Rank r, int n) { copyNodes(L.nodeAt(r), n); }
 
     // 从节点复制构造：复制从节点 p 开始的 n 个节点
     List(ListNodePosi<T> p, int n) { copyNodes(p, n); }
 
-    // 析构函数：释放所有节点（包括哨兵）
-    ~List() {
-        clear();         // 先删除所有实际节点
-        delete header;   // 释放头哨兵
-        delete trailer;  // 释放尾哨兵
+    // 移动构造：接管 L 的全部节点（连同分配器），O(1)；L 随后为空链表
+    List(List<T, Alloc>&& L)
+        : _size(L._size), header(L.header), trailer(L.trailer), _alloc(std::move(L._alloc)),
+          _sortHook(L._sortHook), _finger(L._finger), _fingerRank(L._fingerRank) {
+        L.init();
+    }
+
+    // 移动赋值：释放自身节点后接管 L 的全部节点，O(1)（不计释放）
+    List<T, Alloc>& operator=(List<T, Alloc>&& L) {
+        if (this != &L) {
+            destroyAll();
+            _alloc = std::move(L._alloc);
+            _size = L._size;
+            header = L.header;
+            trailer = L.trailer;
+            _sortHook = L._sortHook;
+            _finger = L._finger;
+            _fingerRank = L._fingerRank;
+            L.init();
+        }
+        return *this;
     }
 
+    // 复制赋值：先复制出一个临时链表，再移动过来
+    List<T, Alloc>& operator=(List<T, Alloc> const& L) {
+        if (this != &L) *this = List<T, Alloc>(L);
+        return *this;
+    }
+
+    // 析构函数：释放所有节点（包括哨兵）
+    ~List() { destroyAll(); }
+
     // 返回链表长度
     Rank size() const { return _size; }
 
     // 判断链表是否为空
     bool empty() const { return _size <= 0; }
 
-    // 重载 [] 运算符：通过秩访问节点数据（类似数组）
-    // 时间复杂度 O(n)，链表不适合随机访问，仅为方便使用
-    T& operator[](Rank r) const {
-        ListNodePosi<T> p = first();
-        for (int i = 0; i < r; i++) p = p->succ;  // 移动到第 r 个节点
-        return p->data;
+    // 按秩取节点：从头、尾或上次访问的位置中最近的一处走过去，并记下本次位置
+    // 单次最坏 O(n)；按秩顺序（或就近）逐个访问时每次 O(1)，整遍扫描 O(n)
+    ListNodePosi<T> nodeAt(Rank r) const {
+        ListNodePosi<T> p = locate(r, _finger, _fingerRank);
+        if (p != header && p != trailer) {
+            _finger = p;
+            _fingerRank = r;
+        }
+        return p;
     }
 
+    // 重载 [] 运算符：通过秩访问节点数据（类似数组），定位方式同 nodeAt()
+    T& operator[](Rank r) const { return nodeAt(r)->data; }
+
+    // 游标：按秩顺序访问链表，自身记录（秩, 节点），与手指互不影响，可同时使用多个。
+    // 与迭代器一样，结构改变（插入、删除、排序等）后不应继续使用
+    class Cursor {
+    private:
+        const List<T, Alloc>* _list;
+        ListNodePosi<T> _node;
+        Rank _rank;
+
+    public:
+        Cursor(const List<T, Alloc>* list, Rank r)
+            : _list(list), _node(list->locate(r, nullptr, 0)), _rank(r) {}
+
+        Rank rank() const { return _rank; }
+        ListNodePosi<T> node() const { return _node; }
+        T& operator*() const { return _node->data; }
+        T* operator->() const { return &_node->data; }
+        // 是否指向实际节点（秩在 [0, size) 内）
+        bool valid() const { return _rank >= 0 && _rank < _list->size(); }
+
+        Cursor& next() { _node = _node->succ; _rank++; return *this; }
+        Cursor& prev() { _node = _node->pred; _rank--; return *this; }
+        Cursor& operator++() { return next(); }
+        Cursor& operator--() { return prev(); }
+        // 跳到秩 r：从当前位置或首尾中最近的一处出发
+        Cursor& seek(Rank r) {
+            _node = _list->locate(r, _node, _rank);
+            _rank = r;
+            return *this;
+        }
+    };
+
+    // 返回指向秩 r 的游标（r 可取 -1 或 size()，分别对应头、尾哨兵）
+    Cursor cursor(Rank r = 0) const { return Cursor(this, r); }
+
+    // 获取节点分配器（池化分配时可由此读取统计信息）
+    const Alloc<ListNode<T>>& allocator() const { return _alloc; }
+
     // 返回第一个实际节点（头哨兵的后继）
     ListNodePosi<T> first() const { return header->succ; }
 
@@ -170,18 +471,20 @@ public:
         return p != nullptr && p != header && p != trailer;
     }
 
-    // 计算链表中逆序对的数量（用于判断链表是否有序）
-    // 若返回 0，说明链表完全有序
-    int disordered() const {
+    // 计算 p 开始的 n 个节点中相邻逆序对的数量（用于判断区间是否有序）
+    // 若返回 0，说明区间完全有序
+    int disordered(ListNodePosi<T> p, int n) const {
         int cnt = 0;
-        ListNodePosi<T> p = first();
-        for (int i = 1; i < _size; i++) {
+        for (int i = 1; i < n; i++) {
             p = p->succ;
-            if (p->pred->data > p->data) cnt++;  // 前驱 > 后继，形成逆序
+            if (p->data < p->pred->data) cnt++;  // 前驱 > 后继，形成逆序
         }
         return cnt;
     }
 
+    // 计算整个链表中相邻逆序对的数量
+    int disordered() const { return disordered(first(), _size); }
+
     // 查找节点：在 p 的前 n 个节点中查找值为 e 的节点（从 p 向前找）
     // 返回找到的节点指针，未找到返回 nullptr
     ListNodePosi<T> find(T const& e, int n, ListNodePosi<T> p) const {
@@ -211,78 +514,155 @@ public:
         return max;
     }
 
-    // 在链表头部插入节点，返回新节点的指针
-    ListNodePosi<T> insertAsFirst(T const& e) {
+    // 在节点 p 之前就地构造新节点（数据由 args 直接构造），返回新节点的指针
+    template <typename... Args>
+    ListNodePosi<T> emplaceB(ListNodePosi<T> p, Args&&... args) {
         _size++;  // 长度 +1
-        // 新节点的前驱是头哨兵，后继是原首节点
-        // 同时更新头哨兵的后继和原首节点的前驱指向新节点
-        return header->succ = header->succ->pred = new ListNode<T>(e, header, header->succ);
+        // 新节点的前驱是 p 的原前驱，后继是 p
+        // 同时更新 p 原前驱的后继和 p 的前驱指向新节点
+        p->pred = p->pred->succ = _alloc.create(piecewise_construct, p->pred, p, std::forward<Args>(args)...);
+        fingerInserted(p->pred);
+        return p->pred;
     }
 
-    // 在链表尾部插入节点，返回新节点的指针
-    ListNodePosi<T> insertAsLast(T const& e) {
-        _size++;  // 长度 +1
-        // 新节点的前驱是原尾节点，后继是尾哨兵
-        // 同时更新原尾节点的后继和尾哨兵的前驱指向新节点
-        return trailer->pred = trailer->pred->succ = new ListNode<T>(e, trailer->pred, trailer);
+    // 在节点 p 之后就地构造新节点
+    template <typename... Args>
+    ListNodePosi<T> emplaceA(ListNodePosi<T> p, Args&&... args) {
+        return emplaceB(p->succ, std::forward<Args>(args)...);
     }
 
+    // 在链表头部、尾部就地构造新节点
+    template <typename... Args>
+    ListNodePosi<T> emplaceAsFirst(Args&&... args) { return emplaceB(header->succ, std::forward<Args>(args)...); }
+    template <typename... Args>
+    ListNodePosi<T> emplaceAsLast(Args&&... args) { return emplaceB(trailer, std::forward<Args>(args)...); }
+
+    // 在链表头部插入节点，返回新节点的指针（右值版本移动数据，不复制）
+    ListNodePosi<T> insertAsFirst(T const& e) { return emplaceAsFirst(e); }
+    ListNodePosi<T> insertAsFirst(T&& e) { return emplaceAsFirst(std::move(e)); }
+
+    // 在链表尾部插入节点，返回新节点的指针
+    ListNodePosi<T> insertAsLast(T const& e) { return emplaceAsLast(e); }
+    ListNodePosi<T> insertAsLast(T&& e) { return emplaceAsLast(std::move(e)); }
+
     // 在节点 p 之后插入节点，返回新节点的指针
-    ListNodePosi<T> insertA(ListNodePosi<T> p, T const& e) {
-        _size++;  // 长度 +1
-        // 新节点的前驱是 p，后继是 p 的原后继
-        // 同时更新 p 的后继和 p 原后继的前驱指向新节点
-        return p->succ = p->succ->pred = new ListNode<T>(e, p, p->succ);
-    }
+    ListNodePosi<T> insertA(ListNodePosi<T> p, T const& e) { return emplaceA(p, e); }
+    ListNodePosi<T> insertA(ListNodePosi<T> p, T&& e) { return emplaceA(p, std::move(e)); }
 
     // 在节点 p 之前插入节点，返回新节点的指针
-    ListNodePosi<T> insertB(ListNodePosi<T> p, T const& e) {
-        _size++;  // 长度 +1
-        // 新节点的前驱是 p 的原前驱，后继是 p
-        // 同时更新 p 原前驱的后继和 p 的前驱指向新节点
-        return p->pred = p->pred->succ = new ListNode<T>(e, p->pred, p);
-    }
+    ListNodePosi<T> insertB(ListNodePosi<T> p, T const& e) { return emplaceB(p, e); }
+    ListNodePosi<T> insertB(ListNodePosi<T> p, T&& e) { return emplaceB(p, std::move(e)); }
 
-    // 删除节点 p，返回节点中存储的数据
+    // 删除节点 p，返回节点中存储的数据（移出，不复制）
     T remove(ListNodePosi<T> p) {
-        T e = p->data;  // 保存节点数据
+        T e = std::move(p->data);  // 保存节点数据
+        fingerRemoving(p);
         // 断开 p 与前后节点的连接：p 的前驱指向 p 的后继，p 的后继指向 p 的前驱
         p->pred->succ = p->succ;
         p->succ->pred = p->pred;
-        delete p;       // 释放 p 的内存
+        _alloc.destroy(p); // 释放 p 的内存
         _size--;        // 长度 -1
         return e;       // 返回删除的数据
     }
 
-    // 归并当前链表与链表 L（归并后 L 会被清空）
-    void merge(List<T>& L) {
-        merge(first(), _size, L, L.first(), L._size);
+    // 接合：把 L 中 [first, last) 这 n 个节点移到当前链表的 pos 之前，返回移入的首节点
+    // 只改指针，O(1)；L 可以就是当前链表，此时 pos 不得位于 [first, last) 之内。
+    // 池化分配时节点归各自的池所有，跨链表接合只能逐个复制后删除，O(n)
+    ListNodePosi<T> splice(ListNodePosi<T> pos, List<T, Alloc>& L,
+                           ListNodePosi<T> first, ListNodePosi<T> last, int n) {
+        if (first == last) return pos;
+        _finger = L._finger = nullptr;
+        if (Alloc<ListNode<T>>::bulkRelease && &L != this) {
+            ListNodePosi<T> head = pos->pred;
+            while (first != last) {
+                ListNodePosi<T> next = first->succ;
+                insertB(pos, L.remove(first));
+                first = next;
+            }
+            return head->succ;
+        }
+        ListNodePosi<T> tail = last->pred;
+        first->pred->succ = last;  // 从 L 中摘下 [first, tail]
+        last->pred = first->pred;
+        first->pred = pos->pred;   // 接到 pos 之前
+        tail->succ = pos;
+        pos->pred->succ = first;
+        pos->pred = tail;
+        if (&L != this) {
+            L._size -= n;
+            _size += n;
+        }
+        return first;
+    }
+
+    // 接合 [first, last)：跨链表时需先数出节点个数，O(n)；同一链表内 O(1)
+    ListNodePosi<T> splice(ListNodePosi<T> pos, List<T, Alloc>& L, ListNodePosi<T> first, ListNodePosi<T> last) {
+        int n = 0;
+        if (&L != this)
+            for (ListNodePosi<T> p = first; p != last; p = p->succ) n++;
+        return splice(pos, L, first, last, n);
+    }
+
+    // 接合单个节点 p
+    ListNodePosi<T> splice(ListNodePosi<T> pos, List<T, Alloc>& L, ListNodePosi<T> p) {
+        return splice(pos, L, p, p->succ, 1);
+    }
+
+    // 接合整个链表 L（L 随之变空）
+    ListNodePosi<T> splice(ListNodePosi<T> pos, List<T, Alloc>& L) {
+        return splice(pos, L, L.first(), L.trailer, L._size);
     }
 
-    // 排序：对 p 开始的 n 个节点排序（随机选择三种算法之一）
+    // 归并当前有序链表与有序链表 L（归并后 L 会被清空）
+    void merge(List<T, Alloc>& L) {
+        ListNodePosi<T> p = first();
+        merge(p, _size, L, L.first(), L._size);
+    }
+
+    // 归并排序公有接口：对 p 开始的 n 个节点或整个链表排序
+    void mergeSortPublic(ListNodePosi<T> p, int n) { mergeSort(p, n); }
+    void mergeSortPublic() { mergeSort(first(), _size); }
+
+    // 设置排序钩子：每次 sort() 结束后以所选策略和用时调用，传 nullptr 取消
+    void setSortHook(ListSortHook hook) { _sortHook = hook; }
+
+    // 排序：对 p 开始的 n 个节点排序（稳定，只比较 <）
+    // 先扫描一遍统计相邻逆序对：已有序则直接返回；区间很短或几乎有序时用插入排序，
+    // 否则用按自然有序段归并的归并排序。插入排序限定比较步数（逆序对虽少但相距很远时
+    // 会退化为平方级），超出后改用归并排序接着完成，因此最坏仍为 O(nlogn)
     void sort(ListNodePosi<T> p, int n) {
-        switch (rand() % 3) {
-            case 0: insertionSort(p, n); break;  // 插入排序（适合小数据或近似有序）
-            case 1: selectionSort(p, n); break;  // 选择排序（简单但效率低）
-            default: mergeSort(p, n);            // 归并排序（效率高，O(nlogn)）
+        typedef chrono::steady_clock Clock;
+        Clock::time_point t0, t1;
+        if (_sortHook) t0 = Clock::now();
+        ListNodePosi<T> before = p->pred;
+        ListSortStats st = { LIST_SORT_NONE, n, disordered(p, n), 0, 0 };
+        if (_sortHook) t1 = Clock::now();
+        if (st.inversions == 0) {
+            // 已有序
+        } else if (n <= LIST_INSERTION_MAX || st.inversions <= n / LIST_NEARLY_SORTED) {
+            st.strategy = LIST_SORT_INSERTION;
+            if (!insertionSort(p, n, (long long)n * LIST_INSERTION_STEPS)) {
+                st.strategy = LIST_SORT_INSERTION_MERGE;
+                mergeSort(before->succ, n);
+            }
+        } else {
+            st.strategy = LIST_SORT_MERGE;
+            mergeSort(p, n);
+        }
+        if (_sortHook) {
+            Clock::time_point t2 = Clock::now();
+            st.scanMs = chrono::duration<double, milli>(t1 - t0).count();
+            st.sortMs = chrono::duration<double, milli>(t2 - t1).count();
+            _sortHook(st);
         }
     }
 
     // 对整个链表排序
     void sort() { sort(first(), _size); }
 
-    // 去重：删除链表中所有重复的节点（保留第一个出现的节点）
-    // 时间复杂度 O(n2)，适合无序链表
-    int deduplicate() {
-        int oldSize = _size;
-        ListNodePosi<T> p = first();
-        for (Rank i = 0; i < _size; p = p->succ, i++) {
-            // 在 p 之前的 i 个节点中查找是否有重复
-            ListNodePosi<T> q = find(p->data, i, p);
-            if (q) remove(q);  // 有重复则删除
-        }
-        return oldSize - _size;  // 返回删除的节点数
-    }
+    // 去重：删除链表中所有重复的节点（每组相等元素保留最后出现的节点），返回删除的节点数
+    // 元素可用 std::hash 散列时借助散列集合，期望 O(n)；否则逐个向前查找，O(n2)。适合无序链表
+    int deduplicate() { return deduplicate(ListHashable<T>()); }
 
     // 有序去重：删除有序链表中连续重复的节点（仅适用于有序链表）
     // 时间复杂度 O(n)，效率更高
@@ -302,6 +682,7 @@ public:
 
     // 反转链表：交换每个节点的前驱和后继指针
     void reverse() {
+        _finger = nullptr;
         ListNodePosi<T> p = header;
         // 交换每个实际节点的前驱和后继
         for (int i = 0; i < _size; i++) {
@@ -336,4 +717,4 @@ void print(T& data) {
     cout << data << " ";
 }
 
-
+#endif // LIST_H
@@ -0,0 +1,77 @@
+#ifndef LISTPARALLEL_H
+#define LISTPARALLEL_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "List.h"
+#include "WorkStealing.h"
+
+// List 的并行排序。单独成一个头文件：只有用到它的程序才引入线程池、<thread> 与原子操作，
+// List.h 本身保持轻量。
+
+const int LIST_PARALLEL_MIN = 1 << 16;  // 并行排序时每块至少这么多节点
+
+// 并行排序：在线程池 pool 上对整个链表排序（稳定，只比较 <）
+// 走一遍把链表等分为 k 块（k 为工作线程数），各块并发地用 sortChain 排成有序链，
+// 再以败者树（tournament tree）k 路归并：每取出一个节点只需沿树上行一次，O(logk) 次比较。
+// 全程只重接指针，除 O(k) 的块首与败者树外不占额外内存。链表较短或只有一个工作线程时退回 sort()
+template <typename T, template <typename> class Alloc>
+void parallelSort(List<T, Alloc>& L, ForkJoinPool& pool) {
+    int size = L._size;
+    int k = std::min(pool.workerCount(), size / LIST_PARALLEL_MIN);
+    if (k < 2) { L.sort(); return; }
+    L._finger = nullptr;
+    std::vector<ListNodePosi<T>> head(k);
+    ListNodePosi<T> p = L.first();
+    for (int i = 0; i < k; i++) {  // 走一遍找出各块首节点
+        head[i] = p;
+        for (int j = (int)((long long)size * i / k); j < (long long)size * (i + 1) / k; j++) p = p->succ;
+    }
+    {
+        TaskGroup g(pool);
+        for (int i = 0; i < k; i++) {
+            int n = (int)((long long)size * (i + 1) / k - (long long)size * i / k);
+            g.spawn([&head, i, n] {
+                ListNodePosi<T> cur = head[i];
+                head[i] = List<T, Alloc>::sortChain(cur, n);
+            });
+        }
+        g.sync();
+    }
+    // 败者树：叶子 k + i 对应第 i 块，loser[j] 记录内部节点 j 处比赛的败者，win 为总冠军。
+    // a 胜 b：a 未取完且（b 已取完或 a 的元素更小，相等时块号小者胜，保证稳定）
+    auto beats = [&head](int a, int b) {
+        if (!head[a]) return false;
+        if (!head[b]) return true;
+        if (head[b]->data < head[a]->data) return false;
+        if (head[a]->data < head[b]->data) return true;
+        return a < b;
+    };
+    std::vector<int> loser(k), win(2 * k);
+    for (int i = 0; i < k; i++) win[k + i] = i;
+    for (int j = k - 1; j >= 1; j--) {
+        int a = win[2 * j], b = win[2 * j + 1];
+        if (beats(a, b)) { win[j] = a; loser[j] = b; }
+        else             { win[j] = b; loser[j] = a; }
+    }
+    int w = win[1];
+    ListNodePosi<T> tail = L.header;
+    while (head[w]) {
+        ListNodePosi<T> x = head[w];
+        head[w] = x->succ;
+        tail->succ = x;  // 接到结果末尾，顺带恢复 pred
+        x->pred = tail;
+        tail = x;
+        for (int j = (k + w) / 2; j >= 1; j /= 2)  // 沿树上行重赛
+            if (beats(loser[j], w)) std::swap(loser[j], w);
+    }
+    tail->succ = L.trailer;
+    L.trailer->pred = tail;
+}
+
+// 在进程级默认线程池上并行排序
+template <typename T, template <typename> class Alloc>
+void parallelSort(List<T, Alloc>& L) { parallelSort(L, ForkJoinPool::instance()); }
+
+#endif // LISTPARALLEL_H
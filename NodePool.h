@@ -0,0 +1,190 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// 节点池统计信息
+struct PoolStats {
+    long long live;   // 当前在用的节点数
+    long long slabs;  // 当前持有的 slab 数
+    long long peak;   // 在用节点数的历史峰值
+};
+
+// 定长节点池：按 slab（一次 SlabNodes 个节点）向系统申请内存，
+// 释放的节点挂入空闲链表复用；release() 时把全部 slab 整块归还。
+// 整块归还的 slab 先进入线程本地缓存（每线程、每种节点类型一份），
+// 同一线程上其他容器再申请时直接复用，不经过 operator new。
+// 池本身不加锁，一个池只应由一个容器（一个线程）使用。
+template <typename Node, int SlabNodes = 256>
+class NodePool {
+private:
+    // 空闲槽位与节点共用存储
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char raw[sizeof(Node)];
+    };
+    struct Slab {
+        Slab* next;
+        Slot slots[SlabNodes];
+    };
+    // 线程本地 slab 缓存
+    struct SlabCache {
+        static const int LIMIT = 64;  // 每线程最多缓存的 slab 数，超出部分直接释放
+        Slab* head;
+        int count;
+        SlabCache() : head(nullptr), count(0) {}
+        ~SlabCache() {
+            while (head) { Slab* s = head; head = s->next; ::operator delete(s); }
+            dead() = true;
+        }
+    };
+    // 线程退出时缓存先于静态对象析构，此后的 release() 直接释放 slab
+    static bool& dead() {
+        static thread_local bool d = false;
+        return d;
+    }
+    static SlabCache* cache() {
+        if (dead()) return nullptr;
+        static thread_local SlabCache c;
+        return &c;
+    }
+
+    Slab* _slabs;     // 已持有的 slab 链表，表头为最新申请的 slab
+    Slot* _free;      // 空闲槽位链表
+    int _bump;        // 最新 slab 中下一个从未使用过的槽位
+    PoolStats _stats;
+
+    // 置为空池（不释放内存，供移动后使用）
+    void reset() {
+        _slabs = nullptr;
+        _free = nullptr;
+        _bump = SlabNodes;
+        _stats.live = _stats.slabs = _stats.peak = 0;
+    }
+
+    // 申请一个新 slab：优先取线程缓存
+    void grow() {
+        SlabCache* c = cache();
+        Slab* s;
+        if (c && c->head) {
+            s = c->head;
+            c->head = s->next;
+            c->count--;
+        } else {
+            s = static_cast<Slab*>(::operator new(sizeof(Slab)));
+        }
+        s->next = _slabs;
+        _slabs = s;
+        _bump = 0;
+        _stats.slabs++;
+    }
+
+public:
+    NodePool() : _slabs(nullptr), _free(nullptr), _bump(SlabNodes) {
+        _stats.live = _stats.slabs = _stats.peak = 0;
+    }
+    ~NodePool() { release(); }
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // 移动：接管 o 的全部 slab 与空闲链表，o 变为空池（容器整体移动时随之转移节点）
+    NodePool(NodePool&& o) noexcept : _slabs(o._slabs), _free(o._free), _bump(o._bump), _stats(o._stats) {
+        o.reset();
+    }
+    // 移动赋值前本池的节点须已全部析构
+    NodePool& operator=(NodePool&& o) noexcept {
+        if (this != &o) {
+            release();
+            _slabs = o._slabs;
+            _free = o._free;
+            _bump = o._bump;
+            _stats = o._stats;
+            o.reset();
+        }
+        return *this;
+    }
+
+    // 分配一个未构造的节点空间
+    void* allocate() {
+        Slot* p;
+        if (_free) {
+            p = _free;
+            _free = p->next;
+        } else {
+            if (_bump == SlabNodes) grow();
+            p = &_slabs->slots[_bump++];
+        }
+        if (++_stats.live > _stats.peak) _stats.peak = _stats.live;
+        return p;
+    }
+
+    // 归还节点空间（节点须已析构）
+    void deallocate(void* q) {
+        Slot* p = static_cast<Slot*>(q);
+        p->next = _free;
+        _free = p;
+        _stats.live--;
+    }
+
+    // 分配并就地构造节点
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        void* p = allocate();
+        return ::new (p) Node(std::forward<Args>(args)...);
+    }
+
+    // 析构并回收节点
+    void destroy(Node* p) {
+        p->~Node();
+        deallocate(p);
+    }
+
+    // 整块归还所有 slab；调用前池中节点须已全部析构（或为平凡析构类型）
+    void release() {
+        SlabCache* c = cache();
+        while (_slabs) {
+            Slab* s = _slabs;
+            _slabs = s->next;
+            if (c && c->count < SlabCache::LIMIT) {
+                s->next = c->head;
+                c->head = s;
+                c->count++;
+            } else {
+                ::operator delete(s);
+            }
+        }
+        _free = nullptr;
+        _bump = SlabNodes;
+        _stats.live = _stats.slabs = 0;
+    }
+
+    // 统计信息
+    PoolStats stats() const { return _stats; }
+};
+
+// ==================== 容器分配策略 ====================
+// Stack/List 通过模板模板参数选择节点的分配方式，两种策略接口一致：
+//   create(args...)  分配并构造节点
+//   destroy(p)       析构并回收节点
+//   release()        整块回收全部节点内存（bulkRelease 为 true 时有效）
+
+// 默认策略：逐个 new/delete，与原实现行为一致
+template <typename Node>
+struct HeapAlloc {
+    static const bool bulkRelease = false;
+    template <typename... Args>
+    Node* create(Args&&... args) { return new Node(std::forward<Args>(args)...); }
+    void destroy(Node* p) { delete p; }
+    void release() {}
+};
+
+// 池化策略：节点来自 NodePool，clear() 时整块归还 slab
+template <typename Node>
+struct PoolAlloc : NodePool<Node> {
+    static const bool bulkRelease = true;
+};
+
+#endif // NODEPOOL_H
@@ -0,0 +1,350 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+#include <stdexcept>
+#include "List.h"
+#include "NodePool.h"
+
+// 可按秩访问的跳表：有序容器，按关键码查找、插入、删除与按秩访问均为期望 O(logn)。
+//
+// 每一层是一条与 List 相同布局的双向链表（data、pred、succ），层与层之间由
+// above/below 相连（四联节点，与教材中 Quadlist 的组织方式一致）。每个节点另记
+// span：沿本层从该节点走到后继所跨过的底层节点数（后继为空时算到表尾之后），
+// 下降时累加 span 即得秩。各层有各自的头哨兵，末尾以 nullptr 结束，
+// 底层从 first() 沿 succ 走到 nullptr 即为全部元素的升序序列。
+//
+// 元素只需支持 <；相等元素按插入先后排列（新元素插在所有相等元素之后）。
+// 塔高按 1/4 的概率逐层增长；由有序序列整体构造时直接按位置确定塔高
+// （第 i 个元素的高度为 i 的因子 4 的个数加 1），O(n) 建成一个完全均衡的跳表。
+// 节点默认来自节点池（见 NodePool.h）。
+
+const int SKIPLIST_MAX_LEVEL = 20;  // 最多 20 层，p = 1/4 时足够容纳 4^20 个元素
+
+// 跳表节点
+template <typename T>
+struct SkipNode {
+    T data;                // 节点存储的数据（高层节点存放同一元素的副本）
+    SkipNode<T>* pred;     // 本层前驱
+    SkipNode<T>* succ;     // 本层后继（nullptr 表示本层末尾）
+    SkipNode<T>* above;    // 上一层的同一元素
+    SkipNode<T>* below;    // 下一层的同一元素
+    int span;              // 到本层后继所跨过的底层节点数
+
+    SkipNode(T const& e = T())
+        : data(e), pred(nullptr), succ(nullptr), above(nullptr), below(nullptr), span(0) {}
+};
+
+template <typename T>
+using SkipNodePosi = SkipNode<T>*;
+
+template <typename T, template <typename> class Alloc = PoolAlloc>
+class SkipList {
+private:
+    int _size;                                     // 元素个数
+    int _levels;                                   // 当前使用的层数（至少 1）
+    SkipNodePosi<T> _head[SKIPLIST_MAX_LEVEL];     // 各层头哨兵，秩为 0
+    SkipNodePosi<T> _tail;                         // 底层末节点（空表时为 nullptr）
+    unsigned long long _seed;                      // 塔高随机数状态（xorshift）
+    Alloc<SkipNode<T>> _alloc;
+
+    void init() {
+        for (int l = 0; l < SKIPLIST_MAX_LEVEL; l++) {
+            _head[l] = _alloc.create();
+            _head[l]->below = l ? _head[l - 1] : nullptr;
+            if (l) _head[l - 1]->above = _head[l];
+            _head[l]->span = 1;  // 空表：从头哨兵算到表尾之后
+        }
+        _size = 0;
+        _levels = 1;
+        _tail = nullptr;
+    }
+
+    // 释放全部节点（含哨兵）
+    void destroyAll() {
+        if (!(Alloc<SkipNode<T>>::bulkRelease && std::is_trivially_destructible<T>::value)) {
+            for (int l = 0; l < SKIPLIST_MAX_LEVEL; l++) {
+                SkipNodePosi<T> x = _head[l];
+                while (x) {
+                    SkipNodePosi<T> next = x->succ;
+                    _alloc.destroy(x);
+                    x = next;
+                }
+            }
+        }
+        _alloc.release();
+    }
+
+    // 随机塔高：每次以 1/4 的概率再加一层
+    int randomLevel() {
+        _seed ^= _seed << 13;
+        _seed ^= _seed >> 7;
+        _seed ^= _seed << 17;
+        unsigned long long r = _seed;
+        int h = 1;
+        while (h < SKIPLIST_MAX_LEVEL && (r & 3) == 0) {
+            h++;
+            r >>= 2;
+        }
+        return h;
+    }
+
+    // 自顶向下查找，记录每层最后一个“在目标之前”的节点及其秩。
+    // before(x, rank) 为真表示节点 x（秩为 rank）位于目标之前
+    template <typename Before>
+    void path(Before before, SkipNodePosi<T>* update, Rank* rk) const {
+        SkipNodePosi<T> x = _head[_levels - 1];
+        Rank r = 0;
+        for (int l = _levels - 1; l >= 0; l--) {
+            while (x->succ && before(x->succ, r + x->span)) {
+                r += x->span;
+                x = x->succ;
+            }
+            update[l] = x;
+            rk[l] = r;
+            if (l) x = x->below;
+        }
+    }
+
+    // 删除以 x 为底的整座塔，update 为到 x 的查找路径
+    T removeTower(SkipNodePosi<T> x, SkipNodePosi<T>* update) {
+        T e = x->data;
+        if (x == _tail) _tail = update[0] != _head[0] ? update[0] : nullptr;
+        int l = 0;
+        for (SkipNodePosi<T> y = x; y; l++) {
+            SkipNodePosi<T> up = y->above;
+            update[l]->span += y->span - 1;
+            update[l]->succ = y->succ;
+            if (y->succ) y->succ->pred = update[l];
+            _alloc.destroy(y);
+            y = up;
+        }
+        for (; l < _levels; l++) update[l]->span--;
+        while (_levels > 1 && !_head[_levels - 1]->succ) _levels--;
+        _size--;
+        return e;
+    }
+
+    // 由有序序列整体构造时在表尾追加 e，tails/tailRank 为各层当前的末节点及其秩
+    void appendSorted(T const& e, SkipNodePosi<T>* tails, Rank* tailRank) {
+        if (_tail && e < _tail->data) throw std::invalid_argument("SkipList: input is not sorted");
+        Rank r = ++_size;
+        int h = 1;
+        for (Rank k = r; h < SKIPLIST_MAX_LEVEL && k % 4 == 0; k /= 4) h++;
+        if (h > _levels) _levels = h;
+        SkipNodePosi<T> below = nullptr;
+        for (int l = 0; l < h; l++) {
+            SkipNodePosi<T> y = _alloc.create(e);
+            y->below = below;
+            if (below) below->above = y;
+            y->pred = tails[l];
+            tails[l]->succ = y;
+            tails[l]->span = r - tailRank[l];
+            tails[l] = y;
+            tailRank[l] = r;
+            below = y;
+        }
+        _tail = tails[0];
+    }
+
+    // 整体构造结束：补齐各层末节点到表尾之后的 span
+    void finishSorted(SkipNodePosi<T>* tails, Rank* tailRank) {
+        for (int l = 0; l < SKIPLIST_MAX_LEVEL; l++) tails[l]->span = _size + 1 - tailRank[l];
+    }
+
+    void beginSorted(SkipNodePosi<T>* tails, Rank* tailRank) {
+        for (int l = 0; l < SKIPLIST_MAX_LEVEL; l++) {
+            tails[l] = _head[l];
+            tailRank[l] = 0;
+        }
+    }
+
+    // 由 n 个有序元素整体构造，next() 依次给出各元素。中途抛出异常（输入无序、分配失败）时
+    // 先释放已建的全部节点再重新抛出：构造函数抛出异常后析构函数不会执行
+    template <typename Next>
+    void buildSorted(Rank n, Next next) {
+        init();
+        SkipNodePosi<T> tails[SKIPLIST_MAX_LEVEL];
+        Rank tailRank[SKIPLIST_MAX_LEVEL];
+        beginSorted(tails, tailRank);
+        try {
+            for (Rank i = 0; i < n; i++) appendSorted(next(), tails, tailRank);
+        } catch (...) {
+            destroyAll();
+            throw;
+        }
+        finishSorted(tails, tailRank);
+    }
+
+public:
+    // 构造空跳表
+    SkipList() : _seed(0x9E3779B97F4A7C15ull) { init(); }
+
+    // 由有序数组 A[0, n) 构造，O(n)；输入无序时抛出 invalid_argument
+    SkipList(T const* A, Rank n) : _seed(0x9E3779B97F4A7C15ull) {
+        buildSorted(n, [&A]() -> T const& { return *A++; });
+    }
+
+    // 由链表中从 p 开始的 n 个有序节点构造，O(n)；输入无序时抛出 invalid_argument
+    SkipList(ListNodePosi<T> p, int n) : _seed(0x9E3779B97F4A7C15ull) {
+        buildSorted(n, [&p]() -> T const& {
+            T const& e = p->data;
+            p = p->succ;
+            return e;
+        });
+    }
+
+    // 复制构造：按有序序列整体重建，O(n)
+    SkipList(SkipList<T, Alloc> const& S) : _seed(S._seed) {
+        SkipNodePosi<T> p = S.first();
+        buildSorted(S._size, [&p]() -> T const& {
+            T const& e = p->data;
+            p = p->succ;
+            return e;
+        });
+    }
+
+    SkipList<T, Alloc>& operator=(SkipList<T, Alloc> const&) = delete;
+
+    ~SkipList() { destroyAll(); }
+
+    Rank size() const { return _size; }
+    bool empty() const { return _size <= 0; }
+    int level() const { return _levels; }
+
+    // 获取节点分配器（池化分配时可由此读取统计信息）
+    const Alloc<SkipNode<T>>& allocator() const { return _alloc; }
+
+    // 底层首、末节点（空表时为 nullptr），沿 succ / pred 可顺序遍历
+    SkipNodePosi<T> first() const { return _head[0]->succ; }
+    SkipNodePosi<T> last() const { return _tail; }
+
+    // 判断 p 是否为底层的有效节点
+    bool valid(SkipNodePosi<T> p) const { return p != nullptr && p != _head[0]; }
+
+    // 清空跳表，返回删除的元素数
+    int clear() {
+        int oldSize = _size;
+        destroyAll();
+        init();
+        return oldSize;
+    }
+
+    // 按秩取底层节点，0 <= r < size()，期望 O(logn)
+    SkipNodePosi<T> nodeAt(Rank r) const {
+        SkipNodePosi<T> x = _head[_levels - 1];
+        Rank k = 0;
+        for (int l = _levels - 1; ; l--) {
+            while (x->succ && k + x->span <= r + 1) {
+                k += x->span;
+                x = x->succ;
+            }
+            if (k == r + 1 || !l) return x;
+            x = x->below;
+        }
+    }
+
+    // 按秩访问（只读：直接改写数据会破坏有序性）
+    T const& operator[](Rank r) const { return nodeAt(r)->data; }
+
+    // 首个不小于 e 的节点，不存在时返回 nullptr
+    SkipNodePosi<T> lowerBound(T const& e) const {
+        SkipNodePosi<T> update[SKIPLIST_MAX_LEVEL];
+        Rank rk[SKIPLIST_MAX_LEVEL];
+        path([&](SkipNodePosi<T> x, Rank) { return x->data < e; }, update, rk);
+        return update[0]->succ;
+    }
+
+    // 首个大于 e 的节点，不存在时返回 nullptr
+    SkipNodePosi<T> upperBound(T const& e) const {
+        SkipNodePosi<T> update[SKIPLIST_MAX_LEVEL];
+        Rank rk[SKIPLIST_MAX_LEVEL];
+        path([&](SkipNodePosi<T> x, Rank) { return !(e < x->data); }, update, rk);
+        return update[0]->succ;
+    }
+
+    // 查找：返回首个等于 e 的节点，不存在时返回 nullptr
+    SkipNodePosi<T> find(T const& e) const {
+        SkipNodePosi<T> p = lowerBound(e);
+        return p && !(e < p->data) ? p : nullptr;
+    }
+
+    // 搜索：返回不大于 e 的最后一个节点（语义同 List::search），不存在时返回 nullptr
+    SkipNodePosi<T> search(T const& e) const {
+        SkipNodePosi<T> update[SKIPLIST_MAX_LEVEL];
+        Rank rk[SKIPLIST_MAX_LEVEL];
+        path([&](SkipNodePosi<T> x, Rank) { return !(e < x->data); }, update, rk);
+        return valid(update[0]) ? update[0] : nullptr;
+    }
+
+    // 小于 e 的元素个数，即 e 插入后（排在相等元素之前时）的秩
+    Rank rank(T const& e) const {
+        SkipNodePosi<T> update[SKIPLIST_MAX_LEVEL];
+        Rank rk[SKIPLIST_MAX_LEVEL];
+        path([&](SkipNodePosi<T> x, Rank) { return x->data < e; }, update, rk);
+        return rk[0];
+    }
+
+    // 插入 e（排在所有相等元素之后），返回底层的新节点
+    SkipNodePosi<T> insert(T const& e) {
+        SkipNodePosi<T> update[SKIPLIST_MAX_LEVEL];
+        Rank rk[SKIPLIST_MAX_LEVEL];
+        path([&](SkipNodePosi<T> x, Rank) { return !(e < x->data); }, update, rk);
+        int h = randomLevel();
+        for (; _levels < h; _levels++) {  // 新增的层从头哨兵开始
+            update[_levels] = _head[_levels];
+            rk[_levels] = 0;
+            _head[_levels]->span = _size + 1;
+        }
+        SkipNodePosi<T> below = nullptr;
+        for (int l = 0; l < h; l++) {
+            SkipNodePosi<T> y = _alloc.create(e);
+            y->below = below;
+            if (below) below->above = y;
+            y->pred = update[l];
+            y->succ = update[l]->succ;
+            if (y->succ) y->succ->pred = y;
+            update[l]->succ = y;
+            // 新节点的秩为 rk[0] + 1，原跨度在新节点处一分为二
+            y->span = update[l]->span - (rk[0] - rk[l]);
+            update[l]->span = rk[0] - rk[l] + 1;
+            below = y;
+        }
+        for (int l = h; l < _levels; l++) update[l]->span++;  // 更高层跨过了新节点
+        _size++;
+        SkipNodePosi<T> x = update[0]->succ;
+        if (!x->succ) _tail = x;
+        return x;
+    }
+
+    // 删除首个等于 e 的元素，成功返回 true
+    bool remove(T const& e) {
+        SkipNodePosi<T> update[SKIPLIST_MAX_LEVEL];
+        Rank rk[SKIPLIST_MAX_LEVEL];
+        path([&](SkipNodePosi<T> x, Rank) { return x->data < e; }, update, rk);
+        SkipNodePosi<T> x = update[0]->succ;
+        if (!x || e < x->data) return false;
+        removeTower(x, update);
+        return true;
+    }
+
+    // 删除秩为 r 的元素并返回，0 <= r < size()
+    T removeAt(Rank r) {
+        SkipNodePosi<T> update[SKIPLIST_MAX_LEVEL];
+        Rank rk[SKIPLIST_MAX_LEVEL];
+        path([&](SkipNodePosi<T>, Rank k) { return k <= r; }, update, rk);
+        return removeTower(update[0]->succ, update);
+    }
+
+    // 遍历（函数指针版本）：按升序访问每个元素
+    void traverse(void (*visit)(T const&)) const {
+        for (SkipNodePosi<T> p = first(); p; p = p->succ) visit(p->data);
+    }
+
+    // 遍历（函数对象版本）
+    template <typename VST>
+    void traverse(VST& visit) const {
+        for (SkipNodePosi<T> p = first(); p; p = p->succ) visit(p->data);
+    }
+};
+
+#endif // SKIPLIST_H
@@ -1,5 +1,11 @@
+#ifndef STACK_H
+#define STACK_H
+
+#include <climits>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
+#include "NodePool.h"
 using namespace std;
 
 // 栈节点结构体
@@ -11,22 +17,25 @@ struct StackNode {
     StackNode(T e = T(), StackNode<T>* n = nullptr) : data(e), next(n) {}
 };
 
-// 栈类
-template <typename T>
-class Stack {
+// 链式栈类：每次入栈分配一个节点，出栈释放节点
+// Alloc 为节点分配策略（见 NodePool.h），默认逐个 new/delete，
+// 取 PoolAlloc 时节点来自节点池，clear() 整块归还内存
+template <typename T, template <typename> class Alloc = HeapAlloc>
+class LinkedStack {
 private:
     int _size;            // 栈的大小（元素个数）
     StackNode<T>* topNode; // 指向栈顶节点的指针
+    Alloc<StackNode<T>> _alloc; // 节点分配器
 public:
     // 构造函数，初始化栈为空
-    Stack() : _size(0), topNode(nullptr) {}
+    LinkedStack() : _size(0), topNode(nullptr) {}
     // 析构函数，清空栈
-    ~Stack() { clear(); }
+    ~LinkedStack() { clear(); }
 
     // 入栈操作
     void push(const T& e) {
         // 创建新节点，将其作为新的栈顶
-        topNode = new StackNode<T>(e, topNode);
+        topNode = _alloc.create(e, topNode);
         ++_size; // 栈大小加1
     }
 
@@ -36,7 +45,7 @@ public:
         StackNode<T>* node = topNode; // 保存当前栈顶节点
         T e = node->data;             // 获取栈顶数据
         topNode = topNode->next;      // 更新栈顶指针
-        delete node;                  // 释放原栈顶节点内存
+        _alloc.destroy(node);         // 释放原栈顶节点内存
         --_size;                      // 栈大小减1
         return e;                     // 返回出栈的数据
     }
@@ -51,8 +60,25 @@ public:
     bool empty() const { return _size == 0; }
     // 获取栈的大小
     int size() const { return _size; }
-    // 清空栈
-    void clear() { while (!empty()) pop(); }
+    // 清空栈：池化分配时整块归还 slab，平凡析构的元素无需逐个出栈
+    void clear() {
+        if (Alloc<StackNode<T>>::bulkRelease) {
+            if (!std::is_trivially_destructible<T>::value)
+                for (StackNode<T>* p = topNode; p; ) {
+                    StackNode<T>* next = p->next;
+                    p->~StackNode<T>();
+                    p = next;
+                }
+            _alloc.release();
+            topNode = nullptr;
+            _size = 0;
+        } else {
+            while (!empty()) pop();
+        }
+    }
+
+    // 获取节点分配器（池化分配时可由此读取统计信息）
+    const Alloc<StackNode<T>>& allocator() const { return _alloc; }
 
     // 遍历栈（函数指针版本）
     void traverse(void (*visit)(T&)) {
@@ -66,4 +92,119 @@ public:
         for (StackNode<T>* p = topNode; p; p = p->next)
             visit(p->data);
     }
+
+    // 只读遍历（供 const 对象使用）
+    void traverse(void (*visit)(const T&)) const {
+        for (const StackNode<T>* p = topNode; p; p = p->next)
+            visit(p->data);
+    }
+    template <typename VST>
+    void traverse(VST& visit) const {
+        for (const StackNode<T>* p = topNode; p; p = p->next)
+            visit(p->data);
+    }
 };
+
+// 栈类：基于连续数组，容量不足时翻倍扩容
+// 元素连续存放，push/pop 不再逐个分配节点；预先 reserve 后全程零分配
+template <typename T>
+class Stack {
+private:
+    static const int DEFAULT_CAPACITY = 8;
+    int _size;            // 栈的大小（元素个数）
+    int _capacity;        // 数组容量
+    T* _elem;             // 元素数组，_elem[_size - 1] 为栈顶
+
+    // 将容量调整为 c（c 不小于当前大小）
+    void resize(int c) {
+        T* oldElem = _elem;
+        _elem = new T[_capacity = c];
+        for (int i = 0; i < _size; ++i)
+            _elem[i] = oldElem[i];
+        delete[] oldElem;
+    }
+
+public:
+    // 构造函数，初始化栈为空（c 为初始容量；explicit：整数不能隐式转换为栈）
+    explicit Stack(int c = DEFAULT_CAPACITY) : _size(0), _capacity(c > 0 ? c : DEFAULT_CAPACITY) {
+        _elem = new T[_capacity];
+    }
+    // 复制构造函数
+    Stack(const Stack<T>& S) : _size(S._size), _capacity(S._capacity) {
+        _elem = new T[_capacity];
+        for (int i = 0; i < _size; ++i) _elem[i] = S._elem[i];
+    }
+    // 赋值运算符
+    Stack<T>& operator=(const Stack<T>& S) {
+        if (this != &S) {
+            T* elem = new T[S._capacity];
+            for (int i = 0; i < S._size; ++i) elem[i] = S._elem[i];
+            delete[] _elem;
+            _elem = elem;
+            _size = S._size;
+            _capacity = S._capacity;
+        }
+        return *this;
+    }
+    // 析构函数，释放数组
+    ~Stack() { delete[] _elem; }
+
+    // 预留容量：保证之后至少 n 个元素入栈都不再扩容
+    void reserve(int n) { if (n > _capacity) resize(n); }
+
+    // 入栈操作
+    void push(const T& e) {
+        if (_size == _capacity) { // 满则容量翻倍，翻倍会超出 int 范围时取 INT_MAX
+            if (_capacity == INT_MAX) throw std::length_error("Stack capacity overflow");
+            resize(_capacity > INT_MAX / 2 ? INT_MAX : _capacity << 1);
+        }
+        _elem[_size++] = e;
+    }
+
+    // 出栈操作
+    T pop() {
+        if (empty()) throw std::out_of_range("Stack is empty!"); // 栈空时抛出异常
+        return _elem[--_size];
+    }
+
+    // 获取栈顶元素的引用
+    T& top() {
+        if (empty()) throw std::out_of_range("Stack is empty!"); // 栈空时抛出异常
+        return _elem[_size - 1];
+    }
+
+    // 判断栈是否为空
+    bool empty() const { return _size == 0; }
+    // 获取栈的大小
+    int size() const { return _size; }
+    // 获取当前容量
+    int capacity() const { return _capacity; }
+    // 清空栈（保留容量，便于复用）
+    void clear() { _size = 0; }
+
+    // 遍历栈（函数指针版本），与链式栈一致，从栈顶到栈底
+    void traverse(void (*visit)(T&)) {
+        for (int i = _size - 1; i >= 0; --i)
+            visit(_elem[i]);
+    }
+
+    // 遍历栈（函数对象版本）
+    template <typename VST>
+    void traverse(VST& visit) {
+        for (int i = _size - 1; i >= 0; --i)
+            visit(_elem[i]);
+    }
+
+    // 只读遍历（供 const 对象使用）
+    void traverse(void (*visit)(const T&)) const {
+        for (int i = _size - 1; i >= 0; --i)
+            visit(_elem[i]);
+    }
+    template <typename VST>
+    void traverse(VST& visit) const {
+        for (int i = _size - 1; i >= 0; --i)
+            visit(_elem[i]);
+    }
+};
+
+#endif // STACK_H
@@ -0,0 +1,353 @@
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+#include <algorithm>
+#include <iostream>
+#include "NodePool.h"
+using namespace std;
+
+typedef int Rank;
+
+// 展开链表（unrolled linked list）：每个节点存放一小段连续的元素，
+// 遍历与查找在节点内部顺序访问数组，指针跳转次数约为 List 的 1/B。
+// 接口与 List 一致，位置由 UnrolledPosi（节点 + 节点内下标）表示。
+//
+// 填充阈值：节点满时对半分裂；删除后元素数低于 B/4 时，
+// 若与相邻节点合计不超过 3B/4 则合并，因此除首尾外节点平均至少约四分之一满。
+// 在给定位置插入、删除只移动节点内至多 B 个元素，摊还 O(1)（B 为常数）。
+//
+// 注意：插入或删除会移动同一节点（以及分裂、合并涉及的节点）内的元素，
+// 此前取得的这些位置随之失效；其他节点上的位置不受影响。
+
+// 默认每节点约 512 字节的元素，大元素至少 8 个
+template <typename T>
+struct UnrolledCapacity {
+    static const int value = sizeof(T) * 8 > 512 ? 8 : (int)(512 / sizeof(T));
+};
+
+// 展开链表节点
+template <typename T, int B>
+struct UnrolledNode {
+    int count;                  // 节点内元素个数
+    UnrolledNode<T, B>* pred;   // 前驱节点
+    UnrolledNode<T, B>* succ;   // 后继节点
+    T elem[B];                  // 元素，有效范围 [0, count)
+
+    UnrolledNode() : count(0), pred(nullptr), succ(nullptr) {}
+};
+
+// 元素位置：节点与节点内下标
+// 头哨兵上的位置表示首元素之前，尾哨兵上的位置表示末元素之后
+template <typename T, int B>
+struct UnrolledPosi {
+    UnrolledNode<T, B>* node;
+    int off;
+
+    T& data() const { return node->elem[off]; }
+    bool operator==(const UnrolledPosi& p) const { return node == p.node && off == p.off; }
+    bool operator!=(const UnrolledPosi& p) const { return !(*this == p); }
+};
+
+template <typename T, int B = UnrolledCapacity<T>::value, template <typename> class Alloc = HeapAlloc>
+class UnrolledList {
+public:
+    typedef UnrolledNode<T, B> Node;
+    typedef UnrolledPosi<T, B> Posi;
+
+private:
+    int _size;        // 元素总数
+    int _nodes;       // 实际节点数（不含哨兵）
+    Node* header;     // 头哨兵
+    Node* trailer;    // 尾哨兵
+    Alloc<Node> _alloc;
+
+    static const int MERGE_BELOW = B / 4 > 0 ? B / 4 : 1;  // 低于此数时尝试合并
+    static const int MERGE_LIMIT = B * 3 / 4 > 0 ? B * 3 / 4 : 1;  // 合并后的元素数上限
+
+    void init() {
+        header = _alloc.create();
+        trailer = _alloc.create();
+        header->succ = trailer;
+        trailer->pred = header;
+        _size = _nodes = 0;
+    }
+
+    // 在 x 之后新建一个空节点
+    Node* insertNodeAfter(Node* x) {
+        Node* n = _alloc.create();
+        n->pred = x;
+        n->succ = x->succ;
+        x->succ->pred = n;
+        x->succ = n;
+        _nodes++;
+        return n;
+    }
+
+    void removeNode(Node* x) {
+        x->pred->succ = x->succ;
+        x->succ->pred = x->pred;
+        _alloc.destroy(x);
+        _nodes--;
+    }
+
+    bool real(Node* x) const { return x != header && x != trailer; }
+
+    // 把 y 的元素全部并入其前驱 x，并删除 y
+    void absorb(Node* x, Node* y) {
+        for (int i = 0; i < y->count; i++) x->elem[x->count + i] = y->elem[i];
+        x->count += y->count;
+        removeNode(y);
+    }
+
+    // 在节点 x 的下标 i 处插入 e（0 <= i <= count），返回新元素的位置
+    Posi insertAt(Node* x, int i, T const& e) {
+        if (x == header) { x = header->succ; i = 0; }
+        if (x == trailer) { x = trailer->pred; i = x->count; }
+        if (x == header) { x = insertNodeAfter(header); i = 0; }  // 空表
+        if (x->count == B) {
+            if (i == B && real(x->succ) && x->succ->count < B) {         // 追加到后继节点开头
+                x = x->succ; i = 0;
+            } else if (i == 0 && real(x->pred) && x->pred->count < B) {  // 追加到前驱节点末尾
+                x = x->pred; i = x->count;
+            } else {                                                      // 对半分裂
+                Node* y = insertNodeAfter(x);
+                int half = B / 2;
+                for (int k = half; k < B; k++) y->elem[k - half] = x->elem[k];
+                y->count = B - half;
+                x->count = half;
+                if (i > half) { x = y; i -= half; }
+            }
+        }
+        for (int k = x->count; k > i; k--) x->elem[k] = x->elem[k - 1];
+        x->elem[i] = e;
+        x->count++;
+        _size++;
+        Posi p = { x, i };
+        return p;
+    }
+
+    void copyFrom(const UnrolledList& L) {
+        init();
+        for (Node* x = L.header->succ; x != L.trailer; x = x->succ) {
+            Node* y = insertNodeAfter(trailer->pred);
+            for (int i = 0; i < x->count; i++) y->elem[i] = x->elem[i];
+            y->count = x->count;
+        }
+        _size = L._size;
+    }
+
+    // 去掉空节点并合并相邻的过空节点（整体过滤之后调用）
+    void compact() {
+        Node* x = header->succ;
+        while (x != trailer) {
+            Node* next = x->succ;
+            if (x->count == 0) {
+                removeNode(x);
+            } else if (real(next) && x->count + next->count <= MERGE_LIMIT) {
+                absorb(x, next);
+                continue;  // x 可能还能继续合并
+            }
+            x = next;
+        }
+    }
+
+public:
+    UnrolledList() { init(); }
+    UnrolledList(UnrolledList const& L) { copyFrom(L); }
+    UnrolledList& operator=(UnrolledList const&) = delete;
+
+    ~UnrolledList() {
+        Node* x = header;
+        while (x) {
+            Node* next = x->succ;
+            _alloc.destroy(x);
+            x = next;
+        }
+        _alloc.release();
+    }
+
+    Rank size() const { return _size; }
+    bool empty() const { return _size <= 0; }
+    int nodeCount() const { return _nodes; }
+
+    // 按秩访问：逐节点跳过，O(n/B)
+    T& operator[](Rank r) const {
+        Node* x = header->succ;
+        while (r >= x->count) { r -= x->count; x = x->succ; }
+        return x->elem[r];
+    }
+
+    // 首元素位置（空表时为尾后位置）
+    Posi first() const { Posi p = { header->succ, 0 }; return p; }
+    // 末元素位置（空表时为首前位置）
+    Posi last() const {
+        Node* x = trailer->pred;
+        Posi p = { x, x == header ? 0 : x->count - 1 };
+        return p;
+    }
+    // 尾后位置
+    Posi end() const { Posi p = { trailer, 0 }; return p; }
+
+    // 后继位置，末元素的后继为尾后位置
+    Posi succ(Posi p) const {
+        if (p.node == header || ++p.off >= p.node->count) { p.node = p.node->succ; p.off = 0; }
+        return p;
+    }
+    // 前驱位置，首元素的前驱为首前位置（头哨兵）
+    Posi pred(Posi p) const {
+        if (--p.off < 0) {
+            p.node = p.node->pred;
+            p.off = p.node == header ? 0 : p.node->count - 1;
+        }
+        return p;
+    }
+
+    bool valid(Posi p) const { return p.node && real(p.node) && p.off >= 0 && p.off < p.node->count; }
+
+    // 相邻逆序对的数量，为 0 时有序
+    int disordered() const {
+        int cnt = 0;
+        const T* prev = nullptr;
+        for (Node* x = header->succ; x != trailer; x = x->succ)
+            for (int i = 0; i < x->count; i++) {
+                if (prev && *prev > x->elem[i]) cnt++;
+                prev = &x->elem[i];
+            }
+        return cnt;
+    }
+
+    // 在 p 的前 n 个元素中查找 e（从 p 向前找），未找到返回 node 为空的位置
+    Posi find(T const& e, int n, Posi p) const {
+        while (n-- > 0) {
+            p = pred(p);
+            if (e == p.data()) return p;
+        }
+        Posi none = { nullptr, 0 };
+        return none;
+    }
+
+    // 在 p 的前 n 个元素中查找不大于 e 的最后者，找不到时返回其前一位置（可能为首前位置）
+    Posi search(T const& e, int n, Posi p) const {
+        while (n-- > 0) {
+            p = pred(p);
+            if (p.data() <= e) return p;
+        }
+        return pred(p);
+    }
+
+    Posi insertAsFirst(T const& e) { return insertAt(header, 0, e); }
+    Posi insertAsLast(T const& e) { return insertAt(trailer, 0, e); }
+    // 在 p 之后插入（p 为首前位置时插到最前）
+    Posi insertA(Posi p, T const& e) {
+        return p.node == header ? insertAt(header, 0, e) : insertAt(p.node, p.off + 1, e);
+    }
+    // 在 p 之前插入（p 为尾后位置时插到最后）
+    Posi insertB(Posi p, T const& e) { return insertAt(p.node, p.off, e); }
+
+    // 删除 p 处的元素，返回原后继元素的新位置（删除可能引起合并，旧位置失效）
+    // 删除后元素数低于 B/4 的节点与相邻节点合并，空节点直接删除
+    Posi erase(Posi p) {
+        Node* x = p.node;
+        for (int k = p.off + 1; k < x->count; k++) x->elem[k - 1] = x->elem[k];
+        x->count--;
+        _size--;
+        Posi next = { x, p.off };
+        if (p.off == x->count) { next.node = x->succ; next.off = 0; }
+        if (x->count == 0) {
+            removeNode(x);
+        } else if (x->count < MERGE_BELOW) {
+            if (real(x->succ) && x->count + x->succ->count <= MERGE_LIMIT) {
+                if (next.node == x->succ) { next.node = x; next.off = x->count; }
+                absorb(x, x->succ);
+            } else if (real(x->pred) && x->pred->count + x->count <= MERGE_LIMIT) {
+                Node* y = x->pred;
+                if (next.node == x) { next.node = y; next.off += y->count; }
+                absorb(y, x);
+            }
+        }
+        return next;
+    }
+
+    // 删除 p 处的元素并返回之
+    T remove(Posi p) {
+        T e = p.data();
+        erase(p);
+        return e;
+    }
+
+    // 稳定排序：元素移到临时数组排序后按原有节点布局写回，不重新分配节点
+    void sort() {
+        if (_size < 2) return;
+        T* buf = new T[_size];
+        int k = 0;
+        for (Node* x = header->succ; x != trailer; x = x->succ)
+            for (int i = 0; i < x->count; i++) buf[k++] = x->elem[i];
+        std::stable_sort(buf, buf + _size);
+        k = 0;
+        for (Node* x = header->succ; x != trailer; x = x->succ)
+            for (int i = 0; i < x->count; i++) x->elem[i] = buf[k++];
+        delete[] buf;
+    }
+
+    // 无序去重：与 List::deduplicate 一致，每组相等元素保留最后出现的一个，O(n^2)
+    // 自后向前逐节点处理，节点内保留的元素先集中到数组尾部，处理完再移回头部
+    int deduplicate() {
+        int oldSize = _size;
+        for (Node* x = trailer->pred; x != header; x = x->pred) {
+            int w = x->count;  // x->elem[w, count) 为本节点已保留的元素
+            for (int r = x->count - 1; r >= 0; r--) {
+                bool dup = false;
+                for (int i = w; i < x->count && !dup; i++) dup = x->elem[i] == x->elem[r];
+                for (Node* y = x->succ; y != trailer && !dup; y = y->succ)
+                    for (int i = 0; i < y->count && !dup; i++) dup = y->elem[i] == x->elem[r];
+                if (!dup) x->elem[--w] = x->elem[r];
+            }
+            std::move(x->elem + w, x->elem + x->count, x->elem);
+            _size -= w;
+            x->count -= w;
+        }
+        compact();
+        return oldSize - _size;
+    }
+
+    // 有序去重：删除连续重复的元素，O(n)
+    int uniquify() {
+        if (_size < 2) return 0;
+        int oldSize = _size;
+        const T* prev = nullptr;
+        for (Node* x = header->succ; x != trailer; x = x->succ) {
+            int w = 0;
+            for (int r = 0; r < x->count; r++) {
+                if (prev && *prev == x->elem[r]) continue;
+                x->elem[w] = x->elem[r];
+                prev = &x->elem[w++];
+            }
+            _size -= x->count - w;
+            x->count = w;
+        }
+        compact();
+        return oldSize - _size;
+    }
+
+    // 反转：各节点内部反转，再反转节点链
+    void reverse() {
+        for (Node* x = header->succ; x != trailer; x = x->succ) std::reverse(x->elem, x->elem + x->count);
+        for (Node* x = header; x; x = x->pred) swap(x->pred, x->succ);  // 交换后原后继在 pred 中
+        swap(header, trailer);
+    }
+
+    // 遍历（函数指针版本）
+    void traverse(void (*visit)(T&)) {
+        for (Node* x = header->succ; x != trailer; x = x->succ)
+            for (int i = 0; i < x->count; i++) visit(x->elem[i]);
+    }
+
+    // 遍历（函数对象版本）
+    template <typename VST>
+    void traverse(VST& visit) {
+        for (Node* x = header->succ; x != trailer; x = x->succ)
+            for (int i = 0; i < x->count; i++) visit(x->elem[i]);
+    }
+};
+
+#endif // UNROLLEDLIST_H
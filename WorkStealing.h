@@ -0,0 +1,372 @@
+#ifndef WORKSTEALING_H
+#define WORKSTEALING_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ==================== Chase–Lev 工作窃取双端队列 ====================
+// 所有者线程在底部 push/pop（后进先出，利于缓存局部性），
+// 其他线程从顶部 steal（先进先出，优先偷走靠近递归树根部的大任务）。
+// 元素类型 T 须为指针等可原子读写的平凡类型。
+// 数组写满时容量翻倍；旧数组可能仍被窃取者读取，统一在析构时释放。
+// 内存序参照 Lê 等人 "Correct and Efficient Work-Stealing for Weak Memory Models"。
+template <typename T>
+class WorkStealingDeque {
+private:
+    struct Array {
+        long long capacity;
+        long long mask;
+        std::atomic<T>* slots;
+        explicit Array(long long c) : capacity(c), mask(c - 1), slots(new std::atomic<T>[c]) {}
+        ~Array() { delete[] slots; }
+        T get(long long i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void put(long long i, T e) { slots[i & mask].store(e, std::memory_order_relaxed); }
+    };
+
+    alignas(64) std::atomic<long long> _top;
+    alignas(64) std::atomic<long long> _bottom;
+    alignas(64) std::atomic<Array*> _array;
+    std::vector<Array*> _retired;  // 扩容后淘汰的旧数组，仅所有者线程访问
+
+    Array* grow(Array* a, long long b, long long t) {
+        Array* bigger = new Array(a->capacity << 1);
+        for (long long i = t; i < b; i++) bigger->put(i, a->get(i));
+        _retired.push_back(a);
+        _array.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+public:
+    explicit WorkStealingDeque(long long capacity = 1024) : _top(0), _bottom(0) {
+        long long c = 1;
+        while (c < capacity) c <<= 1;
+        _array.store(new Array(c), std::memory_order_relaxed);
+    }
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    ~WorkStealingDeque() {
+        delete _array.load(std::memory_order_relaxed);
+        for (Array* a : _retired) delete a;
+    }
+
+    // 所有者线程：压入底部
+    void push(T e) {
+        long long b = _bottom.load(std::memory_order_relaxed);
+        long long t = _top.load(std::memory_order_acquire);
+        Array* a = _array.load(std::memory_order_relaxed);
+        if (b - t > a->capacity - 1) a = grow(a, b, t);
+        a->put(b, e);
+        _bottom.store(b + 1, std::memory_order_release);  // 发布元素，与 steal 中读 _bottom 配对
+    }
+
+    // 所有者线程：从底部弹出，队列空时返回 false
+    bool pop(T& e) {
+        long long b = _bottom.load(std::memory_order_relaxed) - 1;
+        Array* a = _array.load(std::memory_order_relaxed);
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long t = _top.load(std::memory_order_relaxed);
+        if (t > b) {  // 队列已空
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        e = a->get(b);
+        if (t == b) {  // 只剩最后一个元素，与窃取者竞争
+            bool won = _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // 任意线程：从顶部窃取，队列空或竞争失败时返回 false
+    bool steal(T& e) {
+        long long t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long b = _bottom.load(std::memory_order_acquire);
+        if (t >= b) return false;
+        Array* a = _array.load(std::memory_order_acquire);
+        e = a->get(t);
+        return _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                            std::memory_order_relaxed);
+    }
+
+    // 元素个数（瞬时近似值）
+    long long size() const {
+        long long b = _bottom.load(std::memory_order_relaxed);
+        long long t = _top.load(std::memory_order_relaxed);
+        return b > t ? b - t : 0;
+    }
+    bool empty() const { return size() == 0; }
+};
+
+// ==================== fork/join 调度器 ====================
+const int FORKJOIN_MAX_HELP_DEPTH = 256;  // sync 等待时嵌套执行其他任务的最大层数
+
+class TaskGroup;
+
+// 任务基类：由 TaskGroup::spawn 创建，执行完毕后由调度器释放
+struct ForkJoinTask {
+    TaskGroup* group;
+    virtual void run() = 0;
+    virtual ~ForkJoinTask() {}
+};
+
+// 调度统计
+struct ForkJoinStats {
+    long long spawned;        // 提交的任务数
+    long long executed;       // 执行的任务数
+    long long steals;         // 成功窃取次数
+    long long stealAttempts;  // 窃取尝试次数
+};
+
+// 工作窃取线程池：每个工作线程持有一个 Chase–Lev 队列，
+// 工作线程内 spawn 的任务压入自己的队列，外部线程提交的任务进入共享注入队列。
+// 等待（sync）的线程不会阻塞，而是继续执行或窃取其他任务。
+class ForkJoinPool {
+private:
+    struct Worker {
+        ForkJoinPool* pool;
+        int id;
+        WorkStealingDeque<ForkJoinTask*> deque;
+        unsigned rng;
+        alignas(64) std::atomic<long long> spawned, executed, steals, stealAttempts;
+        Worker(ForkJoinPool* p, int i) : pool(p), id(i), rng(2654435761u * (i + 1)),
+            spawned(0), executed(0), steals(0), stealAttempts(0) {}
+    };
+
+    std::vector<Worker*> _workers;
+    std::vector<std::thread> _threads;
+    std::mutex _injectMutex;
+    std::deque<ForkJoinTask*> _inject;       // 外部线程提交的任务
+    std::atomic<long long> _injectSize;
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    std::atomic<int> _sleepers;
+    std::atomic<bool> _stop;
+    std::atomic<long long> _externalSpawned;
+    std::atomic<long long> _externalExecuted;
+
+    static Worker*& current() {
+        static thread_local Worker* w = nullptr;
+        return w;
+    }
+    Worker* self() {
+        Worker* w = current();
+        return w && w->pool == this ? w : nullptr;
+    }
+
+    bool popInject(ForkJoinTask*& t) {
+        if (_injectSize.load(std::memory_order_acquire) == 0) return false;
+        std::lock_guard<std::mutex> g(_injectMutex);
+        if (_inject.empty()) return false;
+        t = _inject.front();
+        _inject.pop_front();
+        _injectSize.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    // 从随机选取的受害者开始轮流尝试窃取
+    bool stealAny(Worker* w, ForkJoinTask*& t) {
+        int n = (int)_workers.size();
+        unsigned r;
+        if (w) {
+            w->rng = w->rng * 1103515245u + 12345u;
+            r = w->rng >> 8;
+        } else {
+            r = (unsigned)std::hash<std::thread::id>()(std::this_thread::get_id());
+        }
+        for (int k = 0; k < n; k++) {
+            Worker* victim = _workers[(r + k) % n];
+            if (victim == w) continue;
+            if (w) w->stealAttempts.fetch_add(1, std::memory_order_relaxed);
+            if (victim->deque.steal(t)) {
+                if (w) w->steals.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool findTask(Worker* w, ForkJoinTask*& t) {
+        if (w && w->deque.pop(t)) return true;
+        if (stealAny(w, t)) return true;
+        return popInject(t);
+    }
+
+    void execute(Worker* w, ForkJoinTask* t);
+
+    void workerLoop(Worker* w) {
+        current() = w;
+        int idle = 0;
+        while (!_stop.load(std::memory_order_acquire)) {
+            ForkJoinTask* t;
+            if (findTask(w, t)) {
+                execute(w, t);
+                idle = 0;
+            } else if (++idle < 64) {
+                std::this_thread::yield();
+            } else {  // 长时间空闲则休眠，提交任务时唤醒
+                std::unique_lock<std::mutex> lk(_sleepMutex);
+                _sleepers.fetch_add(1);
+                _wake.wait_for(lk, std::chrono::milliseconds(1));
+                _sleepers.fetch_sub(1);
+                idle = 0;
+            }
+        }
+        current() = nullptr;
+    }
+
+public:
+    // threads <= 0 时按硬件核数创建工作线程
+    explicit ForkJoinPool(int threads = 0)
+        : _injectSize(0), _sleepers(0), _stop(false), _externalSpawned(0), _externalExecuted(0) {
+        if (threads <= 0) threads = (int)std::max(1u, std::thread::hardware_concurrency());
+        for (int i = 0; i < threads; i++) _workers.push_back(new Worker(this, i));
+        for (int i = 0; i < threads; i++)
+            _threads.emplace_back(&ForkJoinPool::workerLoop, this, _workers[i]);
+    }
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+
+    // 析构前所有任务组须已 sync
+    ~ForkJoinPool() {
+        _stop.store(true, std::memory_order_release);
+        _wake.notify_all();
+        for (std::thread& t : _threads) t.join();
+        for (Worker* w : _workers) delete w;
+    }
+
+    // 进程级默认线程池
+    static ForkJoinPool& instance() {
+        static ForkJoinPool pool;
+        return pool;
+    }
+
+    int workerCount() const { return (int)_workers.size(); }
+
+    // 提交任务：工作线程内压入自己的队列，外部线程进入注入队列
+    void submit(ForkJoinTask* t) {
+        if (Worker* w = self()) {
+            w->deque.push(t);
+            w->spawned.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            std::lock_guard<std::mutex> g(_injectMutex);
+            _inject.push_back(t);
+            _injectSize.fetch_add(1, std::memory_order_release);
+            _externalSpawned.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (_sleepers.load(std::memory_order_relaxed) > 0) _wake.notify_one();
+    }
+
+    // 帮助执行一个任务（供 sync 等待时调用），没有可执行任务时返回 false
+    // 等待中执行的任务自身也会 sync 并继续帮助，窃取来的任务层层嵌套在同一个线程栈上；
+    // 嵌套超过 FORKJOIN_MAX_HELP_DEPTH 层后只弹出自己队列中的任务（即本线程各层任务的子任务），
+    // 栈深因此有界，而所等待的子任务要么在自己队列中，要么正由窃取者执行，不会死锁
+    bool helpOnce() {
+        static thread_local int depth = 0;
+        Worker* w = self();
+        ForkJoinTask* t;
+        bool found = depth < FORKJOIN_MAX_HELP_DEPTH ? findTask(w, t) : (w && w->deque.pop(t));
+        if (!found) return false;
+        depth++;
+        execute(w, t);
+        depth--;
+        return true;
+    }
+
+    // 汇总各工作线程的统计信息
+    ForkJoinStats stats() const {
+        ForkJoinStats s = { _externalSpawned.load(), _externalExecuted.load(), 0, 0 };
+        for (Worker* w : _workers) {
+            s.spawned += w->spawned.load();
+            s.executed += w->executed.load();
+            s.steals += w->steals.load();
+            s.stealAttempts += w->stealAttempts.load();
+        }
+        return s;
+    }
+};
+
+// 任务组：spawn 提交子任务，sync 等待本组全部子任务完成
+// 子任务抛出的第一个异常会在 sync 时重新抛出
+class TaskGroup {
+private:
+    template <typename F>
+    struct FnTask : ForkJoinTask {
+        F fn;
+        explicit FnTask(F&& f) : fn(std::move(f)) {}
+        void run() { fn(); }
+    };
+
+    ForkJoinPool& _pool;
+    std::atomic<long long> _pending;
+    std::mutex _errorMutex;
+    std::exception_ptr _error;
+
+    friend class ForkJoinPool;
+    void finish(std::exception_ptr e) {
+        if (e) {
+            std::lock_guard<std::mutex> g(_errorMutex);
+            if (!_error) _error = e;
+        }
+        _pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+public:
+    explicit TaskGroup(ForkJoinPool& pool = ForkJoinPool::instance()) : _pool(pool), _pending(0) {}
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    // 析构时若仍有未完成的子任务则等待（不重新抛出异常）
+    ~TaskGroup() {
+        while (_pending.load(std::memory_order_acquire) > 0)
+            if (!_pool.helpOnce()) std::this_thread::yield();
+    }
+
+    // 提交子任务 f()
+    template <typename F>
+    void spawn(F f) {
+        ForkJoinTask* t = new FnTask<F>(std::move(f));
+        t->group = this;
+        _pending.fetch_add(1, std::memory_order_relaxed);
+        _pool.submit(t);
+    }
+
+    // 等待全部子任务完成；等待期间当前线程继续执行其他任务
+    void sync() {
+        while (_pending.load(std::memory_order_acquire) > 0)
+            if (!_pool.helpOnce()) std::this_thread::yield();
+        if (_error) {
+            std::exception_ptr e = _error;
+            _error = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+};
+
+inline void ForkJoinPool::execute(Worker* w, ForkJoinTask* t) {
+    std::exception_ptr err;
+    try {
+        t->run();
+    } catch (...) {
+        err = std::current_exception();
+    }
+    TaskGroup* g = t->group;
+    delete t;
+    if (w) w->executed.fetch_add(1, std::memory_order_relaxed);
+    else _externalExecuted.fetch_add(1, std::memory_order_relaxed);
+    g->finish(err);
+}
+
+#endif // WORKSTEALING_H
@@ -0,0 +1,137 @@
+// 并发链表吞吐量基准测试
+// 编译：g++ -O2 -std=c++17 -pthread bench/concurrent_list_bench.cpp -o concurrent_list_bench
+// 用法：concurrent_list_bench [最大线程数] [每线程操作数]
+//
+// 三种负载：
+//   reorder-queue：一半线程 insertAsLast、一半线程 removeFirst（表空时重试），模拟生产者/消费者重排队列
+//   scattered：每个线程在自己的锚点节点之后插入，并删除自己最早插入的节点，修改分散在链表各处
+//   scan-update：一半线程反复遍历（链表约 4096 个元素），一半线程执行 scattered 的修改，只统计修改次数
+// 对比对象为 std::mutex 保护的 List<T>。
+#include "../ConcurrentList.h"
+#include "../List.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 互斥锁保护的 List，接口与 ConcurrentList 一致
+template <typename T>
+class MutexList {
+private:
+    std::mutex _m;
+    List<T> _l;
+public:
+    ListNodePosi<T> insertAsLast(const T& e) { std::lock_guard<std::mutex> g(_m); return _l.insertAsLast(e); }
+    ListNodePosi<T> insertA(ListNodePosi<T> p, const T& e) { std::lock_guard<std::mutex> g(_m); return _l.insertA(p, e); }
+    bool remove(ListNodePosi<T> p) { std::lock_guard<std::mutex> g(_m); _l.remove(p); return true; }
+    bool removeFirst(T& e) {
+        std::lock_guard<std::mutex> g(_m);
+        if (_l.empty()) return false;
+        e = _l.remove(_l.first());
+        return true;
+    }
+    template <typename VST>
+    void traverse(VST& visit) { std::lock_guard<std::mutex> g(_m); _l.traverse(visit); }
+};
+
+struct Sum {
+    long long total = 0;
+    void operator()(const long long& x) { total += x; }
+};
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename L>
+double reorderQueue(int threads, long long ops) {
+    L list;
+    int producers = std::max(1, threads / 2), consumers = std::max(1, threads - producers);
+    long long total = ops * producers;
+    std::atomic<long long> consumed(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> ts;
+    for (int p = 0; p < producers; p++)
+        ts.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            for (long long i = 0; i < ops; i++) list.insertAsLast(i);
+        });
+    for (int c = 0; c < consumers; c++)
+        ts.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            long long e;
+            while (consumed.load(std::memory_order_relaxed) < total)
+                if (list.removeFirst(e)) consumed.fetch_add(1, std::memory_order_relaxed);
+        });
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto& t : ts) t.join();
+    return 2.0 * total / seconds(start) / 1e6;  // 每秒百万次操作（插入与删除各计一次）
+}
+
+// 每个线程的锚点之间预置 fill 个元素；各线程只在自己的锚点之后插入、删除，最多保留 16 个自己的节点
+template <typename L>
+double scattered(int updaters, int scanners, long long ops, int fill) {
+    L list;
+    std::vector<decltype(list.insertAsLast(0))> anchors;
+    for (int t = 0; t < updaters; t++) {
+        anchors.push_back(list.insertAsLast(-1));
+        for (int i = 0; i < fill; i++) list.insertAsLast(i);
+    }
+    std::atomic<bool> go(false), stop(false);
+    std::atomic<long long> sink(0);
+    std::vector<std::thread> ts;
+    for (int t = 0; t < updaters; t++)
+        ts.emplace_back([&, t] {
+            while (!go.load()) std::this_thread::yield();
+            std::deque<decltype(list.insertAsLast(0))> mine;
+            for (long long i = 0; i < ops; i++) {
+                mine.push_back(list.insertA(anchors[t], i));
+                if (mine.size() > 16) {
+                    list.remove(mine.front());
+                    mine.pop_front();
+                }
+            }
+        });
+    for (int s = 0; s < scanners; s++)
+        ts.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            while (!stop.load(std::memory_order_relaxed)) {
+                Sum sum;
+                list.traverse(sum);
+                sink.fetch_add(sum.total, std::memory_order_relaxed);
+            }
+        });
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (int t = 0; t < updaters; t++) ts[t].join();
+    double s = seconds(start);
+    stop.store(true);
+    for (size_t t = updaters; t < ts.size(); t++) ts[t].join();
+    return 2.0 * ops * updaters / s / 1e6;  // 只统计插入与删除
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : 32;
+    long long ops = argc > 2 ? std::atoll(argv[2]) : 1000000;
+    std::printf("workload,list,threads,mops_per_s\n");
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        int pc = std::max(2, t);
+        int half = std::max(1, t / 2);
+        std::printf("reorder-queue,ConcurrentList,%d,%.2f\n", pc, reorderQueue<ConcurrentList<long long>>(pc, ops));
+        std::printf("reorder-queue,MutexList,%d,%.2f\n", pc, reorderQueue<MutexList<long long>>(pc, ops));
+        std::printf("scattered,ConcurrentList,%d,%.2f\n", t, scattered<ConcurrentList<long long>>(t, 0, ops, 64));
+        std::printf("scattered,MutexList,%d,%.2f\n", t, scattered<MutexList<long long>>(t, 0, ops, 64));
+        std::printf("scan-update,ConcurrentList,%d,%.2f\n", 2 * half,
+                    scattered<ConcurrentList<long long>>(half, half, ops / 4, 4096 / half));
+        std::printf("scan-update,MutexList,%d,%.2f\n", 2 * half,
+                    scattered<MutexList<long long>>(half, half, ops / 4, 4096 / half));
+        std::fflush(stdout);
+    }
+    return 0;
+}
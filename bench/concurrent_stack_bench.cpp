@@ -0,0 +1,98 @@
+// 并发栈吞吐量基准测试
+// 编译：g++ -O2 -std=c++17 -pthread bench/concurrent_stack_bench.cpp -o concurrent_stack_bench
+// 用法：concurrent_stack_bench [最大线程数] [每线程操作数]
+//
+// 两种负载：
+//   producer/consumer：一半线程只入栈、一半线程只出栈（栈空时重试）
+//   work-pool：每个线程交替入栈、出栈，模拟 DFS 类任务共享工作池
+// 对比对象为 std::mutex 保护的数组栈 Stack<T>。
+#include "../ConcurrentStack.h"
+#include "../Stack.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 互斥锁保护的栈，接口与 ConcurrentStack 一致
+template <typename T>
+class MutexStack {
+private:
+    std::mutex _m;
+    Stack<T> _s;
+public:
+    void push(const T& e) { std::lock_guard<std::mutex> g(_m); _s.push(e); }
+    bool pop(T& e) {
+        std::lock_guard<std::mutex> g(_m);
+        if (_s.empty()) return false;
+        e = _s.pop();
+        return true;
+    }
+};
+
+template <typename S>
+double producerConsumer(int threads, long long ops) {
+    S stk;
+    int producers = std::max(1, threads / 2), consumers = std::max(1, threads - producers);
+    long long total = ops * producers;
+    std::atomic<long long> consumed(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> ts;
+    for (int p = 0; p < producers; p++)
+        ts.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            for (long long i = 0; i < ops; i++) stk.push(i);
+        });
+    for (int c = 0; c < consumers; c++)
+        ts.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            long long e;
+            while (consumed.load(std::memory_order_relaxed) < total)
+                if (stk.pop(e)) consumed.fetch_add(1, std::memory_order_relaxed);
+        });
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto& t : ts) t.join();
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return 2.0 * total / s / 1e6;  // 每秒百万次操作（push 与 pop 各计一次）
+}
+
+template <typename S>
+double workPool(int threads, long long ops) {
+    S stk;
+    for (long long i = 0; i < 1024; i++) stk.push(i);  // 预置任务
+    std::atomic<bool> go(false);
+    std::vector<std::thread> ts;
+    for (int t = 0; t < threads; t++)
+        ts.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            long long e;
+            for (long long i = 0; i < ops; i++) {
+                if (stk.pop(e)) stk.push(e + 1);
+                else stk.push(i);
+            }
+        });
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto& t : ts) t.join();
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return 2.0 * ops * threads / s / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : 32;
+    long long ops = argc > 2 ? std::atoll(argv[2]) : 1000000;
+    std::printf("workload,stack,threads,mops_per_s\n");
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        int pc = std::max(2, t);
+        std::printf("producer-consumer,ConcurrentStack,%d,%.2f\n", pc, producerConsumer<ConcurrentStack<long long>>(pc, ops));
+        std::printf("producer-consumer,MutexStack,%d,%.2f\n", pc, producerConsumer<MutexStack<long long>>(pc, ops));
+        std::printf("work-pool,ConcurrentStack,%d,%.2f\n", t, workPool<ConcurrentStack<long long>>(t, ops));
+        std::printf("work-pool,MutexStack,%d,%.2f\n", t, workPool<MutexStack<long long>>(t, ops));
+        std::fflush(stdout);
+    }
+    return 0;
+}
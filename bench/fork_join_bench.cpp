@@ -0,0 +1,104 @@
+// fork/join 调度器微基准测试
+// 编译：g++ -O2 -std=c++17 -pthread bench/fork_join_bench.cpp -o fork_join_bench
+// 用法：fork_join_bench [spawn 任务数] [fib 参数]
+//
+//   spawn-overhead：单个任务组内连续 spawn 空任务再 sync，测每个任务的平均开销
+//   fib：递归二分派生（无截断），测细粒度任务下的吞吐与窃取次数
+//   reduce：分治求和（叶子 4096 个元素），测粗粒度任务的加速比
+#include "../WorkStealing.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+long long fib(int n) {
+    if (n < 2) return n;
+    long long a = 0, b = 0;
+    TaskGroup g;
+    g.spawn([&a, n] { a = fib(n - 1); });
+    b = fib(n - 2);
+    g.sync();
+    return a + b;
+}
+
+long long fibSeq(int n) { return n < 2 ? n : fibSeq(n - 1) + fibSeq(n - 2); }
+
+long long reduce(const int* a, long long lo, long long hi) {
+    if (hi - lo <= 4096) {
+        long long s = 0;
+        for (long long i = lo; i < hi; i++) s += a[i];
+        return s;
+    }
+    long long mi = (lo + hi) / 2, left = 0;
+    TaskGroup g;
+    g.spawn([&left, a, lo, mi] { left = reduce(a, lo, mi); });
+    long long right = reduce(a, mi, hi);
+    g.sync();
+    return left + right;
+}
+
+void report(const char* name, double seconds, long long work, const ForkJoinStats& before) {
+    ForkJoinStats s = ForkJoinPool::instance().stats();
+    std::printf("%s,%d,%.3f,%lld,%.1f,%lld,%lld\n", name, ForkJoinPool::instance().workerCount(),
+                seconds * 1e3, s.spawned - before.spawned, seconds * 1e9 / work,
+                s.steals - before.steals, s.stealAttempts - before.stealAttempts);
+}
+
+int main(int argc, char* argv[]) {
+    long long spawns = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    int fibN = argc > 2 ? std::atoi(argv[2]) : 30;
+    ForkJoinPool& pool = ForkJoinPool::instance();
+    std::printf("bench,workers,ms,tasks,ns_per_unit,steals,steal_attempts\n");
+
+    // spawn 开销：在工作线程内部提交，走本地队列
+    {
+        ForkJoinStats before = pool.stats();
+        auto start = std::chrono::steady_clock::now();
+        TaskGroup outer;
+        outer.spawn([spawns] {
+            TaskGroup g;
+            for (long long i = 0; i < spawns; i++) g.spawn([] {});
+            g.sync();
+        });
+        outer.sync();
+        report("spawn-overhead", secondsSince(start), spawns, before);
+    }
+
+    {
+        auto start = std::chrono::steady_clock::now();
+        long long r = fibSeq(fibN);
+        double t = secondsSince(start);
+        std::printf("fib-sequential,1,%.3f,0,%.1f,0,0\n", t * 1e3, t * 1e9 / (r ? r : 1));
+        ForkJoinStats before = pool.stats();
+        start = std::chrono::steady_clock::now();
+        long long p = 0;
+        TaskGroup g;
+        g.spawn([&p, fibN] { p = fib(fibN); });
+        g.sync();
+        report("fib-parallel", secondsSince(start), r ? r : 1, before);
+        if (p != r) { std::fprintf(stderr, "fib 结果不一致\n"); return 1; }
+    }
+
+    {
+        std::vector<int> a(1 << 26);
+        std::iota(a.begin(), a.end(), 0);
+        auto start = std::chrono::steady_clock::now();
+        long long seq = std::accumulate(a.begin(), a.end(), 0LL);
+        double t = secondsSince(start);
+        std::printf("reduce-sequential,1,%.3f,0,%.3f,0,0\n", t * 1e3, t * 1e9 / a.size());
+        ForkJoinStats before = pool.stats();
+        start = std::chrono::steady_clock::now();
+        long long par = 0;
+        TaskGroup g;
+        g.spawn([&par, &a] { par = reduce(a.data(), 0, (long long)a.size()); });
+        g.sync();
+        report("reduce-parallel", secondsSince(start), (long long)a.size(), before);
+        if (par != seq) { std::fprintf(stderr, "求和结果不一致\n"); return 1; }
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+// 并行柱状图最大矩形的校验与基准测试
+// 编译：g++ -O2 -std=c++17 -pthread bench/histogram_parallel_bench.cpp -o histogram_parallel_bench
+// 用法：histogram_parallel_bench [n] [trials]      （默认 n = 2^22，trials = 3）
+//
+// 输入：随机、升序、降序、少量不同值、先升后降（organ-pipe）、全部相等六种，
+// 对每种输入分别以 2、3、4、7、16、64 块（以及自动分块）运行 largestRectangleParallel，
+// 结果须与顺序版本 largestRectangle 逐位相同，否则报告不一致并以非零状态退出。
+// 另对若干不是块大小整数倍的规模做同样的校验，覆盖块边界落在各种位置的情形；
+// 这部分对同一个 ParallelHistogram 依次以各种块数调用 run，同时校验对象可以重复使用。
+// 每种输入给出顺序版本与自动分块并行版本的中位数耗时。
+#include "../exp1/Histogram.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+static double since(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+}
+
+static std::vector<int> makeInput(const std::string& kind, long long n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> h(n);
+    for (long long i = 0; i < n; i++) {
+        if (kind == "random") h[i] = (int)(rng() % 1000000);
+        else if (kind == "sorted") h[i] = (int)(i / 3);
+        else if (kind == "reversed") h[i] = (int)((n - i) / 3);
+        else if (kind == "few-distinct") h[i] = (int)(rng() % 4) * 1000;
+        else if (kind == "organ-pipe") h[i] = (int)std::min(i, n - 1 - i);
+        else h[i] = 7;  // equal
+    }
+    return h;
+}
+
+static double median(std::vector<double> v) {
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+int main(int argc, char** argv) {
+    long long n = argc > 1 ? std::atoll(argv[1]) : 1LL << 22;
+    int trials = argc > 2 ? std::atoi(argv[2]) : 3;
+    const char* kinds[] = { "random", "sorted", "reversed", "few-distinct", "organ-pipe", "equal" };
+    const int chunkCounts[] = { 0, 2, 3, 4, 7, 16, 64 };
+    int mismatches = 0;
+
+    std::printf("n = %lld, trials = %d, workers = %d\n", n, trials, ForkJoinPool::instance().workerCount());
+    std::printf("%-14s %16s %12s %12s %8s\n", "input", "area", "seq(ms)", "par(ms)", "speedup");
+    for (const char* kind : kinds) {
+        std::vector<int> h = makeInput(kind, n, 12345);
+        long long expect = largestRectangle(h.data(), n);
+        for (int c : chunkCounts) {
+            long long got = largestRectangleParallel(h.data(), n, c);
+            if (got != expect) {
+                std::printf("不一致：%s，%d 块，顺序 %lld，并行 %lld\n", kind, c, expect, got);
+                mismatches++;
+            }
+        }
+        std::vector<double> ts, tp;
+        for (int k = 0; k < trials; k++) {
+            auto s = std::chrono::steady_clock::now();
+            volatile long long a = largestRectangle(h.data(), n);
+            ts.push_back(since(s));
+            s = std::chrono::steady_clock::now();
+            volatile long long b = largestRectangleParallel(h.data(), n);
+            tp.push_back(since(s));
+            (void)a;
+            (void)b;
+        }
+        double x = median(ts), y = median(tp);
+        std::printf("%-14s %16lld %12.1f %12.1f %7.2fx\n", kind, expect, x, y, x / y);
+    }
+
+    // 规模不是块大小整数倍时的校验（块数受每块至少 64K 根柱子的限制）
+    const long long sizes[] = { (1LL << 17), (1LL << 17) + 1, 200003, 524287, 1000003 };
+    int checked = 0;
+    for (long long m : sizes)
+        for (const char* kind : kinds) {
+            std::vector<int> h = makeInput(kind, m, (unsigned)m);
+            long long expect = largestRectangle(h.data(), m);
+            ParallelHistogram ph(h.data(), m);  // 同一对象反复 run，不能读到上一次的块信息
+            for (int c : chunkCounts) {
+                long long got = ph.run(c);
+                checked++;
+                if (got != expect) {
+                    std::printf("不一致：%s，n = %lld，%d 块，顺序 %lld，并行 %lld\n", kind, m, c, expect, got);
+                    mismatches++;
+                }
+            }
+        }
+    std::printf("边界规模校验 %d 组；全部不一致共 %d 组\n", checked, mismatches);
+    return mismatches ? 1 : 0;
+}
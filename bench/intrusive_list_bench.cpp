@@ -0,0 +1,87 @@
+// 侵入式链表与 List 的对比基准测试
+// 编译：g++ -O2 -DNDEBUG -std=c++17 bench/intrusive_list_bench.cpp -o intrusive_list_bench
+// 用法：intrusive_list_bench [n] [ops]      （默认 n = 10^6 个连接，ops = 10^7 次触碰）
+//
+// 模拟空闲连接的 LRU 维护：每次随机“触碰”一个连接，把它移到链表末尾。
+//   List<Conn*>     连接中保存自己所在的节点位置，触碰时 remove 再 insertAsLast（删一个节点、新建一个节点）
+//   IntrusiveList   钩子嵌在连接中，触碰时 remove 再 insertAsLast，只改指针
+// 报告耗时与触碰期间的 operator new 次数。
+#include "../IntrusiveList.h"
+#include "../List.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+static long long g_allocs = 0;
+
+void* operator new(std::size_t size) {
+    g_allocs++;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+struct Conn {
+    int fd;
+    long long lastActive;
+    ListNodePosi<Conn*> node;  // List 版本：所在节点
+    ListHook idle;             // IntrusiveList 版本：钩子
+};
+
+static double since(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int ops = argc > 2 ? std::atoi(argv[2]) : 10000000;
+    std::vector<Conn> conns(n);
+    std::vector<int> touch(ops);
+    std::mt19937 rng(2025);
+    for (int i = 0; i < n; i++) conns[i].fd = i;
+    for (int& k : touch) k = (int)(rng() % n);
+
+    double t[2];
+    long long allocs[2], check[2];
+    {
+        List<Conn*> L;
+        for (Conn& c : conns) c.node = L.insertAsLast(&c);
+        long long a0 = g_allocs;
+        auto s = std::chrono::steady_clock::now();
+        for (int i = 0; i < ops; i++) {
+            Conn* c = &conns[touch[i]];
+            L.remove(c->node);
+            c->lastActive = i;
+            c->node = L.insertAsLast(c);
+        }
+        t[0] = since(s);
+        allocs[0] = g_allocs - a0;
+        check[0] = L.first()->data->fd + L.last()->data->fd;
+    }
+    {
+        IntrusiveList<Conn, &Conn::idle> L;
+        for (Conn& c : conns) L.insertAsLast(&c);
+        long long a0 = g_allocs;
+        auto s = std::chrono::steady_clock::now();
+        for (int i = 0; i < ops; i++) {
+            Conn* c = &conns[touch[i]];
+            L.remove(c);
+            c->lastActive = i;
+            L.insertAsLast(c);
+        }
+        t[1] = since(s);
+        allocs[1] = g_allocs - a0;
+        check[1] = L.first()->fd + L.last()->fd;
+    }
+    std::printf("n = %d, ops = %d\n", n, ops);
+    std::printf("%-14s %12s %14s\n", "list", "time(ms)", "allocations");
+    std::printf("%-14s %12.1f %14lld\n", "List<Conn*>", t[0], allocs[0]);
+    std::printf("%-14s %12.1f %14lld\n", "IntrusiveList", t[1], allocs[1]);
+    std::printf("speedup %.1fx\n", t[0] / t[1]);
+    if (check[0] != check[1]) std::printf("校验不一致：%lld / %lld\n", check[0], check[1]);
+    return 0;
+}
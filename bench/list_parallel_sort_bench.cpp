@@ -0,0 +1,60 @@
+// List 并行排序的扩展性基准测试
+// 编译：g++ -O2 -std=c++17 -pthread bench/list_parallel_sort_bench.cpp -o list_parallel_sort_bench
+// 用法：list_parallel_sort_bench [n] [trials] [maxThreads]
+//       （默认 n = 10^7，trials = 3，maxThreads = 硬件核数）
+//
+// 对同一份随机输入，先用单线程 mergeSortPublic() 排序作为基准，再分别在 1, 2, 4, ... 个
+// 工作线程的线程池上调用 parallelSort(L, pool)（ListParallel.h），报告中位数耗时、相对单线程的加速比与并行效率。
+// 链表使用 PoolAlloc：每次建表时节点按顺序从 slab 中取出，各轮的内存布局一致。
+#include "../ListParallel.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+typedef List<int, PoolAlloc> IntList;
+
+static double median(std::vector<double> v) {
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+// threads 为 0 时用单线程 mergeSortPublic
+static double run(const std::vector<int>& input, int threads, int trials) {
+    std::vector<double> ms;
+    ForkJoinPool* pool = threads > 0 ? new ForkJoinPool(threads) : nullptr;
+    for (int t = 0; t < trials; t++) {
+        IntList L;
+        for (int x : input) L.insertAsLast(x);
+        auto s = std::chrono::steady_clock::now();
+        if (pool) parallelSort(L, *pool);
+        else L.mergeSortPublic();
+        ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s).count());
+        if (L.disordered() != 0) std::printf("结果无序！\n");
+    }
+    delete pool;
+    return median(ms);
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    int trials = argc > 2 ? std::atoi(argv[2]) : 3;
+    int maxThreads = argc > 3 ? std::atoi(argv[3]) : (int)std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> input(n);
+    std::mt19937 rng(2025);
+    for (int& x : input) x = (int)rng();
+
+    double base = run(input, 0, trials);
+    std::printf("n = %d, trials = %d, 硬件核数 %u\n", n, trials, std::thread::hardware_concurrency());
+    std::printf("%-10s %12s %9s %11s\n", "threads", "time(ms)", "speedup", "efficiency");
+    std::printf("%-10s %12.1f %8.2fx %10s\n", "serial", base, 1.0, "-");
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        double ms = run(input, t, trials);
+        std::printf("%-10d %12.1f %8.2fx %9.0f%%\n", t, ms, base / ms, 100.0 * base / ms / t);
+        if (t < maxThreads && t * 2 > maxThreads) t = maxThreads / 2;  // 最后一档取 maxThreads
+    }
+    return 0;
+}
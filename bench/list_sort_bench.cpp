@@ -0,0 +1,114 @@
+// List 归并排序基准测试
+// 编译：g++ -O2 -std=c++17 bench/list_sort_bench.cpp -o list_sort_bench
+// 用法：list_sort_bench [n] [trials]      （默认 n = 10^7，trials = 3）
+//
+// 对比原先的递归归并排序（每次走到中点，归并时 insertB(p, L.remove(q)) 逐个删除再新建节点）
+// 与现在只重接指针的自底向上归并排序。输入分随机、已有序、逆序、近似有序四组，
+// 报告中位数耗时与排序期间的 operator new 次数。
+#include "../List.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+static long long g_allocs = 0;
+
+void* operator new(std::size_t size) {
+    g_allocs++;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// 原先的实现，借助公有接口复现
+template <typename T>
+static void oldMerge(List<T>& L, ListNodePosi<T>& p, int n, ListNodePosi<T> q, int m) {
+    ListNodePosi<T> pp = p->pred;
+    while (m > 0 && n > 0) {
+        if (q->data < p->data) {
+            ListNodePosi<T> next = q->succ;
+            L.insertB(p, L.remove(q));
+            q = next;
+            m--;
+        } else {
+            p = p->succ;
+            n--;
+        }
+    }
+    p = pp->succ;
+}
+
+template <typename T>
+static void oldMergeSort(List<T>& L, ListNodePosi<T>& p, int n) {
+    if (n < 2) return;
+    int m = n >> 1;
+    ListNodePosi<T> q = p;
+    for (int i = 0; i < m; i++) q = q->succ;
+    oldMergeSort(L, p, m);
+    oldMergeSort(L, q, n - m);
+    oldMerge(L, p, m, q, n - m);
+}
+
+static std::vector<int> makeInput(int kind, int n) {
+    std::vector<int> v(n);
+    std::mt19937 rng(2025);
+    for (int i = 0; i < n; i++) v[i] = kind == 2 ? n - i : i;
+    if (kind == 0) std::shuffle(v.begin(), v.end(), rng);
+    if (kind == 3)
+        for (int i = 0; i < n / 100; i++) std::swap(v[rng() % n], v[rng() % n]);
+    return v;
+}
+
+struct Result { double ms; long long allocs; bool sorted; };
+
+static Result sortOnce(List<int>& L, bool old) {
+    long long a0 = g_allocs;
+    auto s = std::chrono::steady_clock::now();
+    if (old) {
+        ListNodePosi<int> p = L.first();
+        oldMergeSort(L, p, L.size());
+    } else {
+        L.mergeSortPublic();
+    }
+    Result r;
+    r.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s).count();
+    r.allocs = g_allocs - a0;
+    r.sorted = L.disordered() == 0;
+    return r;
+}
+
+static double median(std::vector<double> v) {
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    int trials = argc > 2 ? std::atoi(argv[2]) : 3;
+    const char* kinds[] = { "random", "sorted", "reversed", "nearly" };
+    std::printf("n = %d, trials = %d\n", n, trials);
+    std::printf("%-10s %12s %12s %8s %14s %14s\n", "input", "old(ms)", "new(ms)", "speedup", "old allocs", "new allocs");
+    for (int k = 0; k < 4; k++) {
+        std::vector<int> input = makeInput(k, n);
+        std::vector<double> a, b;
+        Result x = { 0, 0, true }, y = { 0, 0, true };
+        for (int t = 0; t < trials; t++) {
+            // 两个链表先都建好再排序，使二者节点在内存中的分布相同（建表顺序即地址顺序）
+            List<int> A, B;
+            for (int v : input) A.insertAsLast(v);
+            for (int v : input) B.insertAsLast(v);
+            x = sortOnce(A, true);
+            y = sortOnce(B, false);
+            a.push_back(x.ms);
+            b.push_back(y.ms);
+        }
+        double ma = median(a), mb = median(b);
+        std::printf("%-10s %12.1f %12.1f %7.1fx %14lld %14lld%s\n", kinds[k], ma, mb, ma / mb, x.allocs, y.allocs,
+                    x.sorted && y.sorted ? "" : "  结果无序！");
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+// LRUCache 基准测试
+// 编译：g++ -O2 -std=c++17 -pthread bench/lru_cache_bench.cpp -o lru_cache_bench
+// 用法：lru_cache_bench [ops] [keys] [capacity]      （默认 ops = 4*10^6，keys = 10^6，capacity = 10^5）
+//
+// 负载：关键码服从 Zipf(0.99) 分布，另有 1/8 的操作是一次性扫描的冷关键码；未命中时 put。
+//   单线程：对比 List + unordered_map（命中时 remove 再 insertAsFirst）与 LRUCache 的
+//           LRU / SLRU / LFU 三种策略，给出命中率与吞吐量
+//   多线程：ShardedLRUCache 分片数为 1（相当于一把全局锁）与 16 时，不同线程数的吞吐量
+#include "../LRUCache.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+static double since(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+}
+
+// 预先生成访问序列，计时中不含随机数生成
+static std::vector<long long> workload(int ops, int keys, unsigned long long seed) {
+    std::vector<double> cdf(keys);
+    double sum = 0;
+    for (int i = 0; i < keys; i++) cdf[i] = sum += 1.0 / std::pow(i + 1.0, 0.99);
+    std::vector<long long> w(ops);
+    long long cold = keys;
+    for (int i = 0; i < ops; i++) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        if (seed % 8 == 0) { w[i] = cold++; continue; }
+        double u = (double)(seed >> 11) / (double)(1ull << 53) * sum;
+        w[i] = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+    }
+    return w;
+}
+
+// 旧做法：List 保存条目，unordered_map 索引，命中时摘下再插到表头
+struct MapLRU {
+    size_t cap;
+    List<std::pair<long long, long long> > lru;
+    std::unordered_map<long long, ListNodePosi<std::pair<long long, long long> > > index;
+    long long hits = 0;
+
+    explicit MapLRU(size_t c) : cap(c) {}
+    void access(long long k) {
+        auto it = index.find(k);
+        if (it != index.end()) {
+            hits++;
+            it->second = lru.insertAsFirst(lru.remove(it->second));
+            return;
+        }
+        index[k] = lru.insertAsFirst(std::make_pair(k, k));
+        if ((size_t)lru.size() > cap) {
+            index.erase(lru.last()->data.first);
+            lru.remove(lru.last());
+        }
+    }
+};
+
+int main(int argc, char** argv) {
+    int ops = argc > 1 ? std::atoi(argv[1]) : 4000000;
+    int keys = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    size_t cap = argc > 3 ? (size_t)std::atoll(argv[3]) : 100000;
+    std::vector<long long> w = workload(ops, keys, 88172645463325252ull);
+    std::printf("ops = %d, keys = %d, capacity = %zu\n", ops, keys, cap);
+    std::printf("%-22s %10s %12s\n", "cache", "hit rate", "Mops/s");
+
+    {
+        MapLRU c(cap);
+        auto s = std::chrono::steady_clock::now();
+        for (long long k : w) c.access(k);
+        double ms = since(s);
+        std::printf("%-22s %9.2f%% %12.2f\n", "List+unordered_map", 100.0 * c.hits / ops, ops / ms / 1000);
+    }
+    const char* names[] = { "LRUCache LRU", "LRUCache SLRU", "LRUCache LFU" };
+    CachePolicy policies[] = { CACHE_LRU, CACHE_SLRU, CACHE_LFU };
+    for (int j = 0; j < 3; j++) {
+        LRUCache<long long, long long> c(cap, policies[j]);
+        auto s = std::chrono::steady_clock::now();
+        for (long long k : w) {
+            long long v;
+            if (!c.get(k, v)) c.put(k, k);
+        }
+        double ms = since(s);
+        CacheStats st = c.stats();
+        std::printf("%-22s %9.2f%% %12.2f\n", names[j], 100.0 * st.hits / ops, ops / ms / 1000);
+    }
+
+    int maxThreads = (int)std::thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+    std::printf("\nShardedLRUCache（LRU），每线程 %d 次操作\n", ops / 4);
+    std::printf("%-8s %16s %16s\n", "threads", "1 shard Mops/s", "16 shards Mops/s");
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        double rate[2];
+        int shardCounts[] = { 1, 16 };
+        for (int j = 0; j < 2; j++) {
+            ShardedLRUCache<long long, long long> c(cap, CACHE_LRU, CACHE_ENTRIES, shardCounts[j]);
+            std::vector<std::thread> ts;
+            auto s = std::chrono::steady_clock::now();
+            for (int i = 0; i < t; i++)
+                ts.emplace_back([&c, &w, i, ops] {
+                    for (int k = 0; k < ops / 4; k++) {  // 各线程从序列的不同位置开始
+                        long long key = w[((size_t)i * 7919 + k) % w.size()], v;
+                        if (!c.get(key, v)) c.put(key, key);
+                    }
+                });
+            for (auto& th : ts) th.join();
+            rate[j] = (double)t * (ops / 4) / since(s) / 1000;
+        }
+        std::printf("%-8d %16.2f %16.2f\n", t, rate[0], rate[1]);
+        if (t < maxThreads && t * 2 > maxThreads) t = maxThreads / 2;  // 最后一轮用满全部线程
+    }
+    return 0;
+}
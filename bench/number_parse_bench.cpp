@@ -0,0 +1,142 @@
+// 数值解析吞吐量基准测试
+// 编译：g++ -O2 -std=c++17 bench/number_parse_bench.cpp -o number_parse_bench
+// 用法：number_parse_bench [count] [trials]      （默认 count = 10^6，trials = 5）
+//
+// 对比四种解析方式：原计算器的逐位累加（fraction *= 0.1）、strtod、std::from_chars 与 parseNumber。
+// 输入为空格分隔的数串，分为短整数、短小数、长小数（17 位有效数字）、指数形式与混合五组，
+// 每组报告中位数吞吐量（MB/s）以及与 strtod 结果逐位不同的个数。
+#include "../exp1/NumberParse.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// 原计算器中的扫描方式，作为对照（补上指数部分，按 pow(10, e) 缩放）
+static const char* naiveParse(const char* p, const char* last, double& value) {
+    double num = 0;
+    while (p != last && *p >= '0' && *p <= '9') num = num * 10 + (*p++ - '0');
+    if (p != last && *p == '.') {
+        ++p;
+        double fraction = 0.1;
+        while (p != last && *p >= '0' && *p <= '9') {
+            num += (*p++ - '0') * fraction;
+            fraction *= 0.1;
+        }
+    }
+    if (p != last && *p == 'e') {
+        ++p;
+        bool neg = p != last && *p == '-';
+        if (neg) ++p;
+        int e = 0;
+        while (p != last && *p >= '0' && *p <= '9') e = e * 10 + (*p++ - '0');
+        num *= std::pow(10.0, neg ? -e : e);
+    }
+    value = num;
+    return p;
+}
+
+static const char* strtodParse(const char* p, const char*, double& value) {
+    char* end;
+    value = std::strtod(p, &end);
+    return end;
+}
+
+static const char* fromCharsParse(const char* p, const char* last, double& value) {
+    return std::from_chars(p, last, value).ptr;
+}
+
+static const char* fastParse(const char* p, const char* last, double& value) {
+    return parseNumber(p, last, value);
+}
+
+typedef const char* (*Parser)(const char*, const char*, double&);
+
+static std::string digits(std::mt19937_64& rng, int n, bool leadingNonZero) {
+    std::string s;
+    for (int i = 0; i < n; ++i)
+        s += char('0' + (i == 0 && leadingNonZero ? 1 + rng() % 9 : rng() % 10));
+    return s;
+}
+
+// 生成一组输入，kind：0 短整数，1 短小数，2 长小数，3 指数形式，4 混合
+static std::string makeInput(int kind, int count, std::mt19937_64& rng) {
+    std::string text;
+    for (int i = 0; i < count; ++i) {
+        int k = kind == 4 ? (int)(rng() % 4) : kind;
+        switch (k) {
+            case 0: text += digits(rng, 1 + rng() % 4, true); break;
+            case 1: text += digits(rng, 1 + rng() % 3, true) + "." + digits(rng, 1 + rng() % 3, false); break;
+            case 2: text += digits(rng, 1 + rng() % 3, true) + "." + digits(rng, 14, false); break;
+            case 3:
+                text += digits(rng, 1, true) + "." + digits(rng, 1 + rng() % 6, false) + "e" +
+                        (rng() % 2 ? "-" : "") + std::to_string(rng() % 30);
+                break;
+        }
+        text += ' ';
+    }
+    return text;
+}
+
+struct Result { double mbps; long long mismatches; double checksum; };
+
+static Result measure(Parser parse, const std::string& text, const std::vector<double>& reference, int trials) {
+    std::vector<double> mbps;
+    Result r = { 0, 0, 0 };
+    const char* begin = text.data();
+    const char* last = begin + text.size();
+    for (int t = 0; t <= trials; ++t) {  // 第 0 次为预热
+        long long mismatches = 0;
+        double sum = 0;
+        size_t k = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const char* p = begin; p != last; ++p) {  // 每个数后跟一个空格
+            double v;
+            p = parse(p, last, v);
+            sum += v;
+            if (k < reference.size() && std::memcmp(&v, &reference[k], sizeof v) != 0) ++mismatches;
+            ++k;
+        }
+        auto end = std::chrono::steady_clock::now();
+        if (t == 0) continue;
+        double sec = std::chrono::duration<double>(end - start).count();
+        mbps.push_back(text.size() / sec / 1e6);
+        r.mismatches = mismatches;
+        r.checksum = sum;
+    }
+    std::sort(mbps.begin(), mbps.end());
+    r.mbps = mbps[mbps.size() / 2];
+    return r;
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int trials = argc > 2 ? std::atoi(argv[2]) : 5;
+    const char* kinds[] = { "short-int", "short-dec", "long-dec", "exponent", "mixed" };
+    const char* names[] = { "naive", "strtod", "from_chars", "parseNumber" };
+    Parser parsers[] = { naiveParse, strtodParse, fromCharsParse, fastParse };
+    std::mt19937_64 rng(2025);
+
+    std::printf("%-10s %-12s %10s %12s\n", "input", "parser", "MB/s", "mismatches");
+    for (int kind = 0; kind < 5; ++kind) {
+        std::string text = makeInput(kind, count, rng);
+        std::vector<double> reference;
+        for (const char* p = text.data(); p != text.data() + text.size(); ++p) {
+            double v;
+            p = strtodParse(p, nullptr, v);
+            reference.push_back(v);
+        }
+        for (int k = 0; k < 4; ++k) {
+            // 校验与计时分开：计时轮不比较结果
+            Result check = measure(parsers[k], text, reference, 1);
+            Result timed = measure(parsers[k], text, std::vector<double>(), trials);
+            std::printf("%-10s %-12s %10.1f %12lld\n", kinds[kind], names[k], timed.mbps, check.mismatches);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+// 跳表与有序 List 的对比基准测试
+// 编译：g++ -O2 -std=c++17 bench/skiplist_bench.cpp -o skiplist_bench
+// 用法：skiplist_bench [n] [queries]      （默认 n = 50000，queries = 10000）
+//
+// 测试项目（元素为随机 int）：
+//   insert   逐个有序插入 n 个元素：List 从尾部向前找位置再 insertA（插入排序式），跳表用 insert
+//   search   queries 次查找不大于 k 的最后一个元素：List 从尾部向前扫描，跳表用 search
+//   rank     queries 次随机秩访问：List 的 operator[]，跳表的 operator[]
+//   build    由已排序的 n 个元素整体构造：List 逐个 insertAsLast，跳表 SkipList(A, n)
+#include "../List.h"
+#include "../SkipList.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// 从尾部向前找不大于 k 的最后一个节点，没有时返回头哨兵（插入排序中的查找方式）
+static ListNodePosi<int> listSearch(const List<int>& L, int k) {
+    ListNodePosi<int> head = L.first()->pred;
+    ListNodePosi<int> p = L.last();
+    while (p != head && k < p->data) p = p->pred;
+    return p;
+}
+
+static double since(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 50000;
+    int queries = argc > 2 ? std::atoi(argv[2]) : 10000;
+    std::mt19937 rng(2025);
+    std::vector<int> keys(n), probes(queries), ranks(queries);
+    for (int& k : keys) k = (int)(rng() % (4u * n));
+    for (int& k : probes) k = (int)(rng() % (4u * n));
+    for (int& r : ranks) r = (int)(rng() % n);
+    long long check[2] = { 0, 0 };
+    double t[2][4];
+
+    {   // List
+        auto s = std::chrono::steady_clock::now();
+        List<int> L;
+        for (int k : keys) L.insertA(listSearch(L, k), k);
+        t[0][0] = since(s);
+
+        s = std::chrono::steady_clock::now();
+        for (int k : probes) {
+            ListNodePosi<int> p = listSearch(L, k);
+            check[0] += p != L.first()->pred ? p->data : 0;
+        }
+        t[0][1] = since(s);
+
+        s = std::chrono::steady_clock::now();
+        for (int r : ranks) check[0] += L[r];
+        t[0][2] = since(s);
+
+        std::vector<int> sorted(keys);
+        std::sort(sorted.begin(), sorted.end());
+        s = std::chrono::steady_clock::now();
+        List<int> B;
+        for (int k : sorted) B.insertAsLast(k);
+        t[0][3] = since(s);
+        check[0] += L.disordered() + B.size();
+    }
+    {   // SkipList
+        auto s = std::chrono::steady_clock::now();
+        SkipList<int> S;
+        for (int k : keys) S.insert(k);
+        t[1][0] = since(s);
+
+        s = std::chrono::steady_clock::now();
+        for (int k : probes) {
+            SkipNodePosi<int> p = S.search(k);
+            check[1] += p ? p->data : 0;
+        }
+        t[1][1] = since(s);
+
+        s = std::chrono::steady_clock::now();
+        for (int r : ranks) check[1] += S[r];
+        t[1][2] = since(s);
+
+        std::vector<int> sorted(keys);
+        std::sort(sorted.begin(), sorted.end());
+        s = std::chrono::steady_clock::now();
+        SkipList<int> B(sorted.data(), n);
+        t[1][3] = since(s);
+        check[1] += B.size();
+    }
+
+    const char* names[] = { "insert", "search", "rank", "build" };
+    std::printf("n = %d, queries = %d\n", n, queries);
+    std::printf("%-8s %12s %14s %8s\n", "op", "List(ms)", "SkipList(ms)", "speedup");
+    for (int j = 0; j < 4; j++)
+        std::printf("%-8s %12.1f %14.1f %7.1fx\n", names[j], t[0][j], t[1][j], t[0][j] / t[1][j]);
+    if (check[0] != check[1]) std::printf("校验不一致：%lld / %lld\n", check[0], check[1]);
+    return 0;
+}
@@ -0,0 +1,218 @@
+// Vector 排序基准测试
+// 编译：g++ -O2 -std=c++17 bench/sort_bench.cpp -o sort_bench
+// 用法：sort_bench [--min-n N] [--max-n N] [--trials T] [--warmup W]
+//                  [--quadratic-limit N] [--format csv|json] [--label 版本号] [--seed S]
+// 测试规模依次为 min-n、min-n*10、min-n*100……直到不超过 max-n（默认 1000 到 10^8）
+//
+// 与 exp1 中 testSortingEfficiency 的区别：
+//   1. 每次计时前都从同一份原始数据重新构造向量，不复用已被排过序的向量
+//   2. 先做若干次预热，再重复计时，报告中位数与 p99，而非单次 clock()
+//   3. 用 steady_clock 测量墙钟时间
+//   4. 另用带计数器的元素类型单独跑一次，统计比较次数与赋值（移动）次数，
+//      计数开销不计入计时结果
+//   5. 输出 CSV 或 JSON，可按 --label 区分版本，便于跨版本比较回归
+#include "../Vector.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// ==================== 计数元素 ====================
+// 包装 int，统计 Vector 排序所用运算符（> 与 <=）的比较次数和赋值次数
+struct OpCounter {
+    long long comparisons;
+    long long moves;
+};
+static OpCounter g_ops = {0, 0};
+
+struct Counted {
+    int key;
+    Counted(int k = 0) : key(k) {}
+    Counted(const Counted& o) : key(o.key) { ++g_ops.moves; }
+    Counted& operator=(const Counted& o) { key = o.key; ++g_ops.moves; return *this; }
+    bool operator>(const Counted& o) const { ++g_ops.comparisons; return key > o.key; }
+    bool operator<=(const Counted& o) const { ++g_ops.comparisons; return key <= o.key; }
+    bool operator==(const Counted& o) const { ++g_ops.comparisons; return key == o.key; }
+};
+
+// ==================== 输入形态 ====================
+enum Shape { SORTED, REVERSED, RANDOM, FEW_UNIQUE, ORGAN_PIPE, NEARLY_SORTED, SHAPE_COUNT };
+const char* SHAPE_NAMES[SHAPE_COUNT] = {
+    "sorted", "reversed", "random", "few-unique", "organ-pipe", "nearly-sorted"
+};
+
+// 生成指定形态的数据；固定种子保证每次运行、每个版本的输入完全相同
+std::vector<int> makeInput(Shape shape, int n, unsigned long long seed) {
+    std::mt19937_64 rng(seed ^ (0x9E3779B97F4A7C15ULL * (shape + 1)) ^ (unsigned long long)n);
+    std::vector<int> a(n);
+    switch (shape) {
+        case SORTED:
+            for (int i = 0; i < n; ++i) a[i] = i;
+            break;
+        case REVERSED:
+            for (int i = 0; i < n; ++i) a[i] = n - i;
+            break;
+        case RANDOM:
+            for (int i = 0; i < n; ++i) a[i] = (int)(rng() & 0x7FFFFFFF);
+            break;
+        case FEW_UNIQUE:  // 只有 16 种取值
+            for (int i = 0; i < n; ++i) a[i] = (int)(rng() % 16);
+            break;
+        case ORGAN_PIPE:  // 前半升序、后半降序
+            for (int i = 0; i < n; ++i) a[i] = i < n / 2 ? i : n - i;
+            break;
+        case NEARLY_SORTED: {  // 升序后随机交换约 1% 的位置对
+            for (int i = 0; i < n; ++i) a[i] = i;
+            int swaps = std::max(1, n / 100);
+            for (int k = 0; k < swaps && n > 1; ++k)
+                std::swap(a[rng() % n], a[rng() % n]);
+            break;
+        }
+        default: break;
+    }
+    return a;
+}
+
+// ==================== 排序引擎 ====================
+enum Engine { BUBBLE, MERGE, ENGINE_COUNT };
+const char* ENGINE_NAMES[ENGINE_COUNT] = { "bubbleSort", "mergeSort" };
+
+template <typename T>
+void runEngine(Engine e, Vector<T>& v) {
+    if (e == BUBBLE) v.bubbleSortPublic(0, v.size());
+    else v.mergeSortPublic(0, v.size());
+}
+
+template <typename T>
+bool isSorted(Vector<T>& v) {
+    for (Rank i = 1; i < v.size(); ++i)
+        if (v[i - 1] > v[i]) return false;
+    return true;
+}
+
+// ==================== 统计 ====================
+struct Result {
+    const char* engine;
+    const char* shape;
+    int n;
+    int trials;
+    long long minNs, medianNs, p99Ns;
+    long long comparisons, moves;
+};
+
+// 最近秩法取分位数（samples 须已排序）
+long long percentile(const std::vector<long long>& samples, double q) {
+    size_t idx = (size_t)(q * samples.size() + 0.999999);
+    if (idx > 0) --idx;
+    if (idx >= samples.size()) idx = samples.size() - 1;
+    return samples[idx];
+}
+
+// 对一种（引擎, 形态, 规模）组合做完整测量
+Result measure(Engine e, Shape s, int n, int warmup, int trials, unsigned long long seed) {
+    std::vector<int> src = makeInput(s, n, seed);
+    Result r = { ENGINE_NAMES[e], SHAPE_NAMES[s], n, trials, 0, 0, 0, 0, 0 };
+
+    // 预热：不计时
+    for (int w = 0; w < warmup; ++w) {
+        Vector<int> v(src.data(), n);
+        runEngine(e, v);
+    }
+
+    std::vector<long long> samples;
+    samples.reserve(trials);
+    for (int t = 0; t < trials; ++t) {
+        Vector<int> v(src.data(), n);  // 每次都从原始数据重建
+        auto start = std::chrono::steady_clock::now();
+        runEngine(e, v);
+        auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        if (t == 0 && !isSorted(v)) {
+            std::fprintf(stderr, "%s 在 %s/%d 上的结果未排序\n", r.engine, r.shape, n);
+            std::exit(1);
+        }
+    }
+    std::sort(samples.begin(), samples.end());
+    r.minNs = samples.front();
+    r.medianNs = percentile(samples, 0.5);
+    r.p99Ns = percentile(samples, 0.99);
+
+    // 计数单独跑一次，避免计数开销污染计时
+    std::vector<Counted> csrc(src.begin(), src.end());
+    Vector<Counted> cv(csrc.data(), n);
+    g_ops.comparisons = g_ops.moves = 0;
+    runEngine(e, cv);
+    r.comparisons = g_ops.comparisons;
+    r.moves = g_ops.moves;
+    return r;
+}
+
+// ==================== 输出 ====================
+void printCsvHeader() {
+    std::printf("label,sort,shape,n,trials,min_ns,median_ns,p99_ns,comparisons,moves\n");
+}
+
+void printCsv(const std::string& label, const Result& r) {
+    std::printf("%s,%s,%s,%d,%d,%lld,%lld,%lld,%lld,%lld\n", label.c_str(), r.engine, r.shape,
+                r.n, r.trials, r.minNs, r.medianNs, r.p99Ns, r.comparisons, r.moves);
+    std::fflush(stdout);
+}
+
+void printJson(const std::string& label, const Result& r, bool first) {
+    std::printf("%s\n  {\"label\": \"%s\", \"sort\": \"%s\", \"shape\": \"%s\", \"n\": %d, "
+                "\"trials\": %d, \"min_ns\": %lld, \"median_ns\": %lld, \"p99_ns\": %lld, "
+                "\"comparisons\": %lld, \"moves\": %lld}",
+                first ? "" : ",", label.c_str(), r.engine, r.shape, r.n, r.trials,
+                r.minNs, r.medianNs, r.p99Ns, r.comparisons, r.moves);
+    std::fflush(stdout);
+}
+
+int main(int argc, char* argv[]) {
+    int minN = 1000, maxN = 100000000;
+    int trials = 11, warmup = 2;
+    int quadraticLimit = 100000;  // 冒泡排序为 O(n^2)，超过该规模跳过
+    unsigned long long seed = 20250101ULL;
+    std::string format = "csv", label = "dev";
+
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (!v) { std::fprintf(stderr, "参数 %s 缺少取值\n", a); return 1; }
+        if (!std::strcmp(a, "--min-n")) minN = std::max(1, std::atoi(v));
+        else if (!std::strcmp(a, "--max-n")) maxN = std::atoi(v);
+        else if (!std::strcmp(a, "--trials")) trials = std::max(1, std::atoi(v));
+        else if (!std::strcmp(a, "--warmup")) warmup = std::max(0, std::atoi(v));
+        else if (!std::strcmp(a, "--quadratic-limit")) quadraticLimit = std::atoi(v);
+        else if (!std::strcmp(a, "--format")) format = v;
+        else if (!std::strcmp(a, "--label")) label = v;
+        else if (!std::strcmp(a, "--seed")) seed = std::strtoull(v, nullptr, 10);
+        else { std::fprintf(stderr, "未知参数 %s\n", a); return 1; }
+        ++i;
+    }
+
+    bool json = format == "json";
+    if (json) std::printf("[");
+    else printCsvHeader();
+
+    bool first = true;
+    for (long long n = minN; n <= maxN; n *= 10) {
+        // 大规模时减少重复次数，否则单个组合就要运行数分钟
+        int t = n >= 10000000 ? std::min(trials, 3) : trials;
+        int w = n >= 10000000 ? std::min(warmup, 1) : warmup;
+        for (int e = 0; e < ENGINE_COUNT; ++e) {
+            if (e == BUBBLE && n > quadraticLimit) continue;
+            for (int s = 0; s < SHAPE_COUNT; ++s) {
+                Result r = measure((Engine)e, (Shape)s, (int)n, w, t, seed);
+                if (json) printJson(label, r, first);
+                else printCsv(label, r);
+                first = false;
+            }
+        }
+    }
+    if (json) std::printf("\n]\n");
+    return 0;
+}
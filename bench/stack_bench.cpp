@@ -0,0 +1,92 @@
+// 数组栈与链式栈的对比基准测试
+// 编译：g++ -O2 -std=c++17 bench/stack_bench.cpp -o stack_bench
+// 用法：stack_bench [n] [trials]      （默认 n = 10^7，可传 100000000 测 10^8）
+//
+// 负载为单调栈求柱状图最大矩形，与 exp1 中 largestRectangleArea 的内层循环相同。
+// 通过替换全局 operator new 统计计时区间内的堆分配次数：
+// 数组栈 reserve 之后应为 0，链式栈每次入栈一次分配。
+#include "../Stack.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+static long long g_allocs = 0;
+
+void* operator new(std::size_t sz) {
+    ++g_allocs;
+    if (void* p = std::malloc(sz ? sz : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// 单调栈扫描（面积用 64 位，避免大规模输入溢出）
+template <typename S>
+long long scan(const std::vector<int>& h, S& stk) {
+    long long maxArea = 0;
+    int n = (int)h.size();
+    for (int i = 0; i <= n; ++i) {
+        int cur = i < n ? h[i] : -1;  // 末尾哨兵高度 -1，清空栈
+        while (!stk.empty() && cur < h[stk.top()]) {
+            long long height = h[stk.pop()];
+            int left = stk.empty() ? -1 : stk.top();
+            maxArea = std::max(maxArea, height * (i - left - 1));
+        }
+        stk.push(i);
+    }
+    stk.pop();
+    return maxArea;
+}
+
+struct Timing { double medianMs; long long allocs; long long area; };
+
+template <typename S, typename Prepare>
+Timing run(const std::vector<int>& h, int trials, Prepare prepare) {
+    std::vector<double> ms;
+    Timing t = { 0, 0, 0 };
+    for (int k = 0; k <= trials; ++k) {  // 第 0 次为预热
+        S stk;
+        prepare(stk);
+        long long before = g_allocs;
+        auto start = std::chrono::steady_clock::now();
+        t.area = scan(h, stk);
+        auto end = std::chrono::steady_clock::now();
+        if (k == 0) continue;
+        t.allocs = g_allocs - before;
+        ms.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    std::sort(ms.begin(), ms.end());
+    t.medianMs = ms[ms.size() / 2];
+    return t;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    int trials = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+
+    // 随机高度与递增高度两种输入：后者令栈深度达到 n，是最坏情况
+    std::mt19937 rng(12345);
+    std::vector<int> randomH(n), risingH(n);
+    for (int i = 0; i < n; ++i) {
+        randomH[i] = (int)(rng() % 10000);
+        risingH[i] = i;
+    }
+
+    struct Case { const char* name; const std::vector<int>* h; } cases[] = {
+        { "random", &randomH }, { "rising", &risingH }
+    };
+    std::printf("input,stack,n,median_ms,allocs_in_scan,max_area\n");
+    for (const Case& c : cases) {
+        Timing linked = run<LinkedStack<int>>(*c.h, trials, [](LinkedStack<int>&) {});
+        Timing grown = run<Stack<int>>(*c.h, trials, [](Stack<int>&) {});
+        Timing reserved = run<Stack<int>>(*c.h, trials, [n](Stack<int>& s) { s.reserve(n + 1); });
+        std::printf("%s,LinkedStack,%d,%.2f,%lld,%lld\n", c.name, n, linked.medianMs, linked.allocs, linked.area);
+        std::printf("%s,Stack,%d,%.2f,%lld,%lld\n", c.name, n, grown.medianMs, grown.allocs, grown.area);
+        std::printf("%s,Stack+reserve,%d,%.2f,%lld,%lld\n", c.name, n, reserved.medianMs, reserved.allocs, reserved.area);
+    }
+    return 0;
+}
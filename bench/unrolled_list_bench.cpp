@@ -0,0 +1,123 @@
+// 展开链表与 List 的对比基准测试
+// 编译：g++ -O2 -std=c++17 bench/unrolled_list_bench.cpp -o unrolled_list_bench
+// 用法：unrolled_list_bench [n] [trials]      （默认 n = 10^7，trials = 3）
+//
+// 测试项目（元素为 int）：
+//   build     逐个 insertAsLast 建表
+//   traverse  traverse 求和
+//   find      find 查找不存在的值（向前扫描全部 n 个元素）
+//   insert    从头走到尾，每隔 8 个元素 insertA 一个新元素（n/8 次定位插入）
+//   remove    从头走到尾，删除上一步插入的元素（展开链表用 erase 取得后继位置）
+// 每项取 trials 次的中位数，并给出展开链表的加速比。
+#include "../List.h"
+#include "../UnrolledList.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+struct Sum {
+    long long total = 0;
+    void operator()(int& x) { total += x; }
+};
+
+struct Times { double build, traverse, find, insert, remove; long long check; };
+
+static double since(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+}
+
+static Times runList(int n) {
+    Times t = { 0, 0, 0, 0, 0, 0 };
+    auto s = std::chrono::steady_clock::now();
+    List<int> L;
+    for (int i = 0; i < n; i++) L.insertAsLast(i);
+    t.build = since(s);
+
+    s = std::chrono::steady_clock::now();
+    Sum sum;
+    L.traverse(sum);
+    t.traverse = since(s);
+
+    s = std::chrono::steady_clock::now();
+    ListNodePosi<int> miss = L.find(-1, n, L.last()->succ);
+    t.find = since(s);
+
+    s = std::chrono::steady_clock::now();
+    ListNodePosi<int> p = L.first();
+    for (int i = 0; i < n; i++, p = p->succ)
+        if (i % 8 == 0) p = L.insertA(p, -i);
+    t.insert = since(s);
+
+    s = std::chrono::steady_clock::now();
+    p = L.first();
+    for (int i = 0; i < n; i++) {
+        if (i % 8 == 0) L.remove(p->succ);
+        p = p->succ;
+    }
+    t.remove = since(s);
+    t.check = sum.total + (miss != nullptr) + L.size();
+    return t;
+}
+
+static Times runUnrolled(int n) {
+    typedef UnrolledList<int> UL;
+    Times t = { 0, 0, 0, 0, 0, 0 };
+    auto s = std::chrono::steady_clock::now();
+    UL L;
+    for (int i = 0; i < n; i++) L.insertAsLast(i);
+    t.build = since(s);
+
+    s = std::chrono::steady_clock::now();
+    Sum sum;
+    L.traverse(sum);
+    t.traverse = since(s);
+
+    s = std::chrono::steady_clock::now();
+    UL::Posi miss = L.find(-1, n, L.end());
+    t.find = since(s);
+
+    s = std::chrono::steady_clock::now();
+    UL::Posi p = L.first();
+    for (int i = 0; i < n; i++, p = L.succ(p))
+        if (i % 8 == 0) p = L.insertA(p, -i);  // 插入后原位置可能失效，改用返回的新位置继续
+    t.insert = since(s);
+
+    s = std::chrono::steady_clock::now();
+    p = L.first();
+    for (int i = 0; i < n; i++)
+        p = i % 8 == 0 ? L.erase(L.succ(p)) : L.succ(p);  // erase 返回被删元素之后的位置
+    t.remove = since(s);
+    t.check = sum.total + (miss.node != nullptr) + L.size();
+    return t;
+}
+
+static double median(std::vector<double> v) {
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    int trials = argc > 2 ? std::atoi(argv[2]) : 3;
+    const char* names[] = { "build", "traverse", "find", "insert", "remove" };
+    std::vector<double> a[5], b[5];
+    long long ca = 0, cb = 0;
+    for (int k = 0; k < trials; k++) {
+        Times x = runList(n), y = runUnrolled(n);
+        double xs[] = { x.build, x.traverse, x.find, x.insert, x.remove };
+        double ys[] = { y.build, y.traverse, y.find, y.insert, y.remove };
+        for (int j = 0; j < 5; j++) { a[j].push_back(xs[j]); b[j].push_back(ys[j]); }
+        ca = x.check;
+        cb = y.check;
+    }
+    std::printf("n = %d, trials = %d, UnrolledList<int> 每节点 %d 个元素\n", n, trials, UnrolledCapacity<int>::value);
+    std::printf("%-10s %12s %14s %8s\n", "op", "List(ms)", "Unrolled(ms)", "speedup");
+    for (int j = 0; j < 5; j++) {
+        double x = median(a[j]), y = median(b[j]);
+        std::printf("%-10s %12.1f %14.1f %7.1fx\n", names[j], x, y, x / y);
+    }
+    if (ca != cb) std::printf("校验不一致：%lld / %lld\n", ca, cb);
+    return 0;
+}
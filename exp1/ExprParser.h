@@ -0,0 +1,261 @@
+#ifndef EXPRPARSER_H
+#define EXPRPARSER_H
+
+#include <stdexcept>
+#include <string>
+
+// ׺ʽȳ㷨ڱֵͬһʵ
+//
+// parseInfix() ʷȼƥ䣬ģֵջԷȱٲıʽ
+// ÿʶһ򰴺׺˳ȷһͽ Sink 
+//   const char* number(const char* p, const char* end)   p ͷĽλãʱ p
+//   void variable(const char* name, int len)             
+//   void op(char c)                                      'n' ΪһԪ
+//  compile()  Stack<char> ջֽ룻
+//  constEval() ö FixedStackֱֵ
+//
+// кΪ constexprҪ C++14ֵʱߵ throw
+// õþͲǳʽڵôڱڱ¶
+
+// ջ N ڱȷڳֵ
+template <typename T, int N>
+class FixedStack {
+private:
+    T _elem[N];
+    int _size;
+
+public:
+    constexpr FixedStack() : _elem(), _size(0) {}
+
+    constexpr void push(const T& e) {
+        if (_size == N) throw std::length_error("Expression too complex");
+        _elem[_size++] = e;
+    }
+    constexpr T pop() {
+        if (_size == 0) throw std::runtime_error("Stack is empty!");
+        return _elem[--_size];
+    }
+    constexpr T& top() {
+        if (_size == 0) throw std::runtime_error("Stack is empty!");
+        return _elem[_size - 1];
+    }
+    constexpr bool empty() const { return _size == 0; }
+    constexpr int size() const { return _size; }
+};
+
+constexpr bool exprIsSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+constexpr bool exprIsDigit(char c) { return c >= '0' && c <= '9'; }
+constexpr bool exprIsAlpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+// ȼж
+constexpr int precedence(char op) {
+    switch(op) {
+        case '+':
+        case '-': return 1;
+        case '*':
+        case '/': return 2;
+        case 'n': return 3;  // һԪ
+        default: return 0; // '('0
+    }
+}
+
+// ִ
+constexpr double operate(double a, double b, char op) {
+    switch(op) {
+        case '+': return a + b;
+        case '-': return a - b;
+        case '*': return a * b;
+        case '/':
+            if (b == 0) throw std::runtime_error("Division by zero");
+            return a / b;
+        default: throw std::runtime_error("Invalid operator");
+    }
+}
+
+// һ sinkͬʱģջ
+template <typename Sink>
+constexpr void emitOperator(Sink& sink, char op, int& depth) {
+    if (depth < (op == 'n' ? 1 : 2)) throw std::runtime_error("Invalid expression");
+    if (op != 'n') depth--;
+    sink.op(op);
+}
+
+//  [s, s + n)ֵջ
+//  calculate() һ£Ųƥ䡢Чַȱٲʱ׳ runtime_error
+// ųڱʽͷ'(' ֮󣨿ɸոʱΪһԪţȼڳ˳
+template <typename OpStack, typename Sink>
+constexpr int parseInfix(const char* s, int n, OpStack& opStack, Sink& sink) {
+    int depth = 0, maxDepth = 0;   // ģֵʱջ
+    bool expectOperand = true;     // һǺӦΪһԪţ
+    int i = 0;
+    while (i < n) {
+        char c = s[i];
+        if (exprIsSpace(c)) {  // ո
+            i++;
+            continue;
+        }
+
+        if (exprIsDigit(c) || c == '.') {  // ֣Сָʽ
+            const char* end = sink.number(s + i, s + n);
+            if (end == s + i) {  // С
+                throw std::runtime_error("Invalid character: .");
+            }
+            i = (int)(end - s);
+            if (++depth > maxDepth) maxDepth = depth;
+            expectOperand = false;
+        }
+        else if (exprIsAlpha(c) || c == '_') {  // 
+            int start = i;
+            while (i < n && (exprIsAlpha(s[i]) || exprIsDigit(s[i]) || s[i] == '_')) i++;
+            sink.variable(s + start, i - start);
+            if (++depth > maxDepth) maxDepth = depth;
+            expectOperand = false;
+        }
+        else if (c == '(') {
+            opStack.push(c);
+            expectOperand = true;
+            i++;
+        }
+        else if (c == ')') {
+            while (!opStack.empty() && opStack.top() != '(') {
+                emitOperator(sink, opStack.pop(), depth);
+            }
+            if (opStack.empty()) {
+                throw std::runtime_error("Mismatched parentheses (missing '(')");
+            }
+            opStack.pop();  // 
+            expectOperand = false;
+            i++;
+        }
+        else if (c == '+' || c == '-' || c == '*' || c == '/') {
+            if (c == '-' && expectOperand) {
+                opStack.push('n');  // һԪΪǰ׺ֱջ
+            } else {
+                while (!opStack.empty() && precedence(opStack.top()) >= precedence(c)) {
+                    emitOperator(sink, opStack.pop(), depth);
+                }
+                opStack.push(c);
+            }
+            expectOperand = true;
+            i++;
+        }
+        else {
+            throw std::runtime_error("Invalid character: " + std::string(1, c));
+        }
+    }
+
+    while (!opStack.empty()) {
+        char op = opStack.pop();
+        if (op == '(') {
+            throw std::runtime_error("Mismatched parentheses (missing ')')");
+        }
+        emitOperator(sink, op, depth);
+    }
+    if (depth != 1) {
+        throw std::runtime_error("Invalid expression");
+    }
+    return maxDepth;
+}
+
+// ==================== ֵ ====================
+
+const int CONST_EVAL_DEPTH = 64;  // ֵջջջһ
+
+// ڵֵֻ߾ȷĿ·Чֲ 19 λβ <= 2^53|ָ| <= 22
+//  parseNumber() λͬд޷ڱڱ֤ȷ룬ֱӱ
+constexpr const char* parseNumberExact(const char* p, const char* end, double& value) {
+    const double pow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const char* first = p;
+    unsigned long long w = 0;
+    int nd = 0, exp10 = 0;
+    bool any = false;
+    for (; p != end && exprIsDigit(*p); ++p) {
+        any = true;
+        if (w != 0 || *p != '0') { w = w * 10 + (unsigned long long)(*p - '0'); nd++; }
+        if (nd > 19) throw std::runtime_error("Too many digits for compile-time parsing");
+    }
+    if (p != end && *p == '.') {
+        const char* frac = ++p;
+        for (; p != end && exprIsDigit(*p); ++p) {
+            if (w != 0 || *p != '0') { w = w * 10 + (unsigned long long)(*p - '0'); nd++; }
+            if (nd > 19) throw std::runtime_error("Too many digits for compile-time parsing");
+            exp10--;
+        }
+        if (!any && p == frac) return first;
+    } else if (!any) {
+        return first;
+    }
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool neg = false;
+        if (q != end && (*q == '+' || *q == '-')) { neg = *q == '-'; ++q; }
+        if (q != end && exprIsDigit(*q)) {
+            int e = 0;
+            for (; q != end && exprIsDigit(*q); ++q)
+                if (e < 100000) e = e * 10 + (*q - '0');
+            exp10 += neg ? -e : e;
+            p = q;
+        }
+    }
+    if (w == 0) {
+        value = 0;
+        return p;
+    }
+    if (w > (1ull << 53) || exp10 < -22 || exp10 > 22)
+        throw std::runtime_error("Number cannot be parsed exactly at compile time");
+    value = exp10 < 0 ? (double)w / pow10[-exp10] : (double)w * pow10[exp10];
+    return p;
+}
+
+// ֱֵ sinkջΪջֱ֧
+template <int N>
+struct ConstEvalSink {
+    FixedStack<double, N> values;
+
+    constexpr const char* number(const char* p, const char* end) {
+        double v = 0;
+        const char* q = parseNumberExact(p, end, v);
+        if (q != p) values.push(v);
+        return q;
+    }
+    constexpr void variable(const char*, int) {
+        throw std::runtime_error("Unbound variable");
+    }
+    constexpr void op(char c) {
+        if (c == 'n') {
+            values.push(-values.pop());
+            return;
+        }
+        double b = values.pop();
+        double a = values.pop();
+        values.push(operate(a, b, c));
+    }
+};
+
+// ֵ [s, s + n)ڱڵãconstexpr static_assertҲڵ
+template <int N = CONST_EVAL_DEPTH>
+constexpr double constEval(const char* s, int n) {
+    FixedStack<char, N> ops;
+    ConstEvalSink<N> sink;
+    parseInfix(s, n, ops, sink);
+    return sink.values.pop();
+}
+
+// ַ汾constexpr double v = constEval("1 + 2 * 3");
+template <int L>
+constexpr double constEval(const char (&s)[L]) {
+    return constEval(s, L - 1);
+}
+
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+// C++20ǿڱֵʽʱʧ
+template <int L>
+consteval double calc(const char (&s)[L]) {
+    return constEval(s, L - 1);
+}
+#endif
+
+#endif // EXPRPARSER_H
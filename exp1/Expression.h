@@ -0,0 +1,240 @@
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include "../Stack.h"
+#include "../WorkStealing.h"
+#include "ExprParser.h"
+#include "NumberParse.h"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ʽֵ
+// compile() ֻһδʷ﷨ ExprParser.h׺ʽתΪ׺沨ֽ룻
+// eval() ڶ˳ִֽ룬ٷڴ棬ʺͬһʽֵ
+// ʽɺĸ»߿ͷıʶֵʱ Program::vars ˳ṩȡֵ
+// evalBatch() ֵֿÿָһݡ
+
+// ָֽ
+enum OpCode : unsigned char {
+    OP_PUSH,  // ѹ볣 value
+    OP_VAR,   // ѹ slot 
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_NEG,   // ջȡ
+    OP_STORE, // ջƵ slot ʱԪջ
+    OP_LOAD   // ѹ slot ʱԪ
+};
+
+struct Instr {
+    OpCode op;
+    int slot;      // OP_VAR ıţOP_STORE / OP_LOAD ʱԪ
+    double value;  //  OP_PUSH ʹ
+};
+
+// ׺ֽ롢ֵջʱԪ
+struct Program {
+    std::vector<Instr> code;
+    int maxDepth = 0;
+    int temps = 0;                  // ʱԪ optimize() 
+    std::vector<std::string> vars;  // ״γֵ˳
+
+    // ıţڷ -1
+    int varIndex(const std::string& name) const {
+        for (size_t k = 0; k < vars.size(); ++k)
+            if (vars[k] == name) return (int)k;
+        return -1;
+    }
+};
+
+const int EVAL_STACK_SIZE = 64;  // eval ʹõĶջʱ˻ضϷ
+
+// ѷдֽ sink ExprParser.h
+struct ProgramSink {
+    Program& prog;
+
+    const char* number(const char* p, const char* end) {
+        double num = 0;
+        const char* q = parseNumber(p, end, num);  // ȷ
+        if (q != p) {
+            Instr in = { OP_PUSH, 0, num };
+            prog.code.push_back(in);
+        }
+        return q;
+    }
+    void variable(const char* name, int len) {
+        std::string s(name, len);
+        int slot = prog.varIndex(s);
+        if (slot < 0) {
+            slot = (int)prog.vars.size();
+            prog.vars.push_back(s);
+        }
+        Instr in = { OP_VAR, slot, 0 };
+        prog.code.push_back(in);
+    }
+    void op(char c) {
+        Instr in = { OP_NEG, 0, 0 };
+        switch (c) {
+            case '+': in.op = OP_ADD; break;
+            case '-': in.op = OP_SUB; break;
+            case '*': in.op = OP_MUL; break;
+            case '/': in.op = OP_DIV; break;
+            case 'n': in.op = OP_NEG; break;
+            default: throw std::runtime_error("Invalid operator");
+        }
+        prog.code.push_back(in);
+    }
+};
+
+// 룺ȳ㷨parseInfixֵã׺ֽ
+//  calculate() һ£Ųƥ䡢Чַȱٲʱ׳ runtime_error
+// Ҫֵʱȷ eval() ׳
+inline Program compile(const std::string& expr) {
+    Program prog;
+    Stack<char> opStack;  // ջȲ
+    ProgramSink sink = { prog };
+    prog.maxDepth = parseInfix(expr.data(), (int)expr.size(), opStack, sink);
+    return prog;
+}
+
+// ڸջռִֽ룬vars Ϊȡֵ
+// stk  maxDepth + temps ԪʱԪλջռ֮
+inline double runProgram(const Program& prog, double* stk, const double* vars) {
+    int top = 0;
+    double* tmp = stk + prog.maxDepth;
+    const Instr* code = prog.code.data();
+    const Instr* end = code + prog.code.size();
+    for (const Instr* p = code; p != end; ++p) {
+        switch (p->op) {
+            case OP_PUSH: stk[top++] = p->value; break;
+            case OP_VAR: stk[top++] = vars[p->slot]; break;
+            case OP_ADD: top--; stk[top - 1] += stk[top]; break;
+            case OP_SUB: top--; stk[top - 1] -= stk[top]; break;
+            case OP_MUL: top--; stk[top - 1] *= stk[top]; break;
+            case OP_DIV:
+                top--;
+                if (stk[top] == 0) throw std::runtime_error("Division by zero");
+                stk[top - 1] /= stk[top];
+                break;
+            case OP_NEG: stk[top - 1] = -stk[top - 1]; break;
+            case OP_STORE: tmp[p->slot] = stk[top - 1]; break;
+            case OP_LOAD: stk[top++] = tmp[p->slot]; break;
+        }
+    }
+    return stk[0];
+}
+
+// ֵջ EVAL_STACK_SIZE ʱȫ̲ڴ
+// vars Ϊ prog.vars иȡֵʽʱʡ
+inline double eval(const Program& prog, const double* vars = nullptr) {
+    if (!vars && !prog.vars.empty())
+        throw std::runtime_error("Unbound variable: " + prog.vars[0]);
+    if (prog.maxDepth + prog.temps <= EVAL_STACK_SIZE) {
+        double stk[EVAL_STACK_SIZE];
+        return runProgram(prog, stk, vars);
+    }
+    std::vector<double> stk(prog.maxDepth + prog.temps);
+    return runProgram(prog, stk.data(), vars);
+}
+
+// ȡֵֵnames  values һһӦ
+inline double eval(const Program& prog, const std::vector<std::string>& names,
+                   const std::vector<double>& values) {
+    std::vector<double> vars(prog.vars.size());
+    for (size_t k = 0; k < prog.vars.size(); ++k) {
+        size_t j = std::find(names.begin(), names.end(), prog.vars[k]) - names.begin();
+        if (j >= names.size() || j >= values.size())
+            throw std::runtime_error("Unbound variable: " + prog.vars[k]);
+        vars[k] = values[j];
+    }
+    return eval(prog, vars.data());
+}
+
+// ==================== ֵ ====================
+
+const int EVAL_BLOCK = 256;             // ÿ
+const long long PARALLEL_ROWS = 1 << 16; // ʱֶβ
+
+//  [lo, hi) зֵֿblk Ϊ maxDepth + temps ĹʱԪĿջ֮
+// ÿָͬһ㣬ڲѭ޷֧ɱ -O3
+inline void evalRows(const Program& prog, const double* const* columns, double* out,
+                     long long lo, long long hi, double* blk) {
+    double* tmp = blk + (long long)prog.maxDepth * EVAL_BLOCK;
+    for (long long base = lo; base < hi; base += EVAL_BLOCK) {
+        int len = (int)std::min<long long>(EVAL_BLOCK, hi - base);
+        int top = 0;
+        //  k ջ飻ֻջȷиÿʱãԽָ
+        auto at = [blk](int k) { return blk + (long long)k * EVAL_BLOCK; };
+        for (const Instr& in : prog.code) {
+            switch (in.op) {
+                case OP_PUSH: {
+                    double* d = at(top++);
+                    for (int j = 0; j < len; ++j) d[j] = in.value;
+                    break;
+                }
+                case OP_VAR:
+                    std::memcpy(at(top++), columns[in.slot] + base, len * sizeof(double));
+                    break;
+                case OP_ADD: case OP_SUB: case OP_MUL: case OP_DIV: {
+                    double* a = at(top - 2);  // ջ
+                    double* b = at(top - 1);  // ջ
+                    if (in.op == OP_ADD) for (int j = 0; j < len; ++j) a[j] += b[j];
+                    else if (in.op == OP_SUB) for (int j = 0; j < len; ++j) a[j] -= b[j];
+                    else if (in.op == OP_MUL) for (int j = 0; j < len; ++j) a[j] *= b[j];
+                    else {
+                        int zero = 0;
+                        for (int j = 0; j < len; ++j) zero |= b[j] == 0;
+                        if (zero) throw std::runtime_error("Division by zero");
+                        for (int j = 0; j < len; ++j) a[j] /= b[j];
+                    }
+                    top--;
+                    break;
+                }
+                case OP_NEG: {
+                    double* b = at(top - 1);
+                    for (int j = 0; j < len; ++j) b[j] = -b[j];
+                    break;
+                }
+                case OP_STORE:
+                    std::memcpy(tmp + (long long)in.slot * EVAL_BLOCK, at(top - 1), len * sizeof(double));
+                    break;
+                case OP_LOAD:
+                    std::memcpy(at(top++), tmp + (long long)in.slot * EVAL_BLOCK, len * sizeof(double));
+                    break;
+            }
+        }
+        std::memcpy(out + base, blk, len * sizeof(double));
+    }
+}
+
+// ֵcolumns[k] Ϊ prog.vars[k] һȡֵд out[0..rows)
+// threads == 1 ʱ̣߳϶ʱֶ߳Σ fork/join ̳߳ز
+// һгʱ׳ runtime_errorout ֤д룩
+inline void evalBatch(const Program& prog, const double* const* columns, double* out,
+                      long long rows, int threads = 0) {
+    int depth = std::max(prog.maxDepth + prog.temps, 1);
+    ForkJoinPool& pool = ForkJoinPool::instance();
+    if (threads <= 0) threads = pool.workerCount();
+    long long parts = std::min<long long>(threads * 4, rows / PARALLEL_ROWS);
+    if (threads == 1 || parts <= 1) {
+        std::vector<double> blk((size_t)depth * EVAL_BLOCK);
+        evalRows(prog, columns, out, 0, rows, blk.data());
+        return;
+    }
+    TaskGroup g(pool);
+    for (long long k = 0; k < parts; ++k) {
+        long long lo = rows * k / parts, hi = rows * (k + 1) / parts;
+        g.spawn([&prog, columns, out, lo, hi, depth] {
+            std::vector<double> blk((size_t)depth * EVAL_BLOCK);
+            evalRows(prog, columns, out, lo, hi, blk.data());
+        });
+    }
+    g.sync();
+}
+
+#endif // EXPRESSION_H
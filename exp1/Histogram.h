@@ -0,0 +1,306 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include "../Stack.h"
+#include "../WorkStealing.h"
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+// ״ͼεĹںˣһ 64 λ height * width 
+
+// ˳汾ջһɨ O(n)
+// stk Ϊ÷ṩջеʱɷͬһԤռ䣨ýʱΪգ
+inline long long largestRectangle(const int* heights, long long n, Stack<long long>& stk) {
+    long long maxArea = 0;
+    for (long long i = 0; i <= n; ++i) {
+        int cur = i < n ? heights[i] : -1;  // ĩβø߶ -1 ջ
+        while (!stk.empty() && cur < heights[stk.top()]) {
+            long long height = heights[stk.pop()];
+            long long left = stk.empty() ? -1 : stk.top();
+            maxArea = std::max(maxArea, height * (i - left - 1));
+        }
+        stk.push(i);
+    }
+    stk.pop();  // ĩβڱλã¿ջ
+    return maxArea;
+}
+
+inline long long largestRectangle(const int* heights, long long n) {
+    Stack<long long> stk;  // 洢ĵջ
+    stk.reserve((int)std::min<long long>(n + 1, 1 << 20));
+    return largestRectangle(heights, n, stk);
+}
+
+// а汾гɿ鲢ɨ裬ľͨСֵϲ
+//
+// ÿ jȡ L = ϸӣR = ҲĲӣ
+// ѡΪ h[j] * (R - L - 1)žҲӵĺѡǡΪֵ
+// ѡǺϷΣкѡֵ˳㷨ȫһ£λͬ
+//
+//   һ飨鲢УСֵǰ׺ϸСֵС׺ϸСֵ
+//   ڶ飨˳򣩣    ڿСֵϽϡST ֧ O(log ) 
+//   飨鲢Уڵջ L/RҲ L ӣջʱջգ߶β
+//                       ɨʱջеӣҲ Rջ¸߶ȵݼ
+//                       ǵĿ߽綼ƶڿĺ׺/ǰ׺Сֵ˳ǰ
+//                       鶼ʱ ST һܵĿ飬ÿӾ̯ O(1)
+// chunks <= 0 ʱ߳Զֿ飻ģСʱֱ˻Ϊ˳汾
+class ParallelHistogram {
+private:
+    struct Chunk {
+        long long lo, hi;
+        int minHeight;
+        std::vector<long long> prefixMins;  // ϸµ͵λã߶ȵݼ
+        std::vector<long long> suffixMins;  // ϸµ͵λã߶ȵݼ
+        long long best;
+    };
+
+    const int* h;
+    long long n;
+    std::vector<Chunk> chunks;
+    std::vector<std::vector<int>> st;  // st[p][c] =  [c, c + 2^p) С߶
+
+    // ÿ run һεĽ
+    void summarize(Chunk& c) {
+        c.prefixMins.clear();
+        c.suffixMins.clear();
+        int m = h[c.lo];
+        c.prefixMins.push_back(c.lo);
+        for (long long i = c.lo + 1; i < c.hi; ++i)
+            if (h[i] < m) { m = h[i]; c.prefixMins.push_back(i); }
+        c.minHeight = m;
+        m = h[c.hi - 1];
+        c.suffixMins.push_back(c.hi - 1);
+        for (long long i = c.hi - 2; i >= c.lo; --i)
+            if (h[i] < m) { m = h[i]; c.suffixMins.push_back(i); }
+    }
+
+    void buildSparseTable() {
+        int k = (int)chunks.size();
+        st.assign(1, std::vector<int>(k));
+        for (int c = 0; c < k; ++c) st[0][c] = chunks[c].minHeight;
+        for (int p = 1; (1 << p) <= k; ++p) {
+            st.push_back(std::vector<int>(k - (1 << p) + 1));
+            for (int c = 0; c + (1 << p) <= k; ++c)
+                st[p][c] = std::min(st[p - 1][c], st[p - 1][c + (1 << (p - 1))]);
+        }
+    }
+
+    //  c ĺϸ x ӵĿ飬ڷ -1
+    int leftChunk(int c, int x) const {
+        int pos = c;  //  [0, pos) вңСֵ >= x Ŀ
+        for (int p = (int)st.size() - 1; p >= 0; --p)
+            if (pos - (1 << p) >= 0 && st[p][pos - (1 << p)] >= x) pos -= 1 << p;
+        return pos - 1;
+    }
+
+    //  c Ҳĺ x ӵĿ飬ڷؿ
+    int rightChunk(int c, int x) const {
+        int k = (int)chunks.size();
+        int pos = c + 1;  //  [pos, k) вңСֵ > x Ŀ
+        for (int p = (int)st.size() - 1; p >= 0; --p)
+            if (pos + (1 << p) <= k && st[p][pos] > x) pos += 1 << p;
+        return pos;
+    }
+
+    //  ci ı߽α꣺βѯ߶Ȳ xϸ x ӣΪ -1
+    // αͣڿ q ĺ׺Сֵе t Խ߶ȶ֮ǰѯ x֮Ĳѯͬ
+    struct LeftCursor {
+        const ParallelHistogram& H;
+        int q;
+        size_t t;
+        LeftCursor(const ParallelHistogram& hist, int ci) : H(hist), q(ci - 1), t(0) {}
+        long long find(int x) {
+            while (q >= 0) {
+                const std::vector<long long>& s = H.chunks[q].suffixMins;
+                while (t < s.size() && H.h[s[t]] >= x) t++;
+                if (t < s.size()) return s[t];
+                q = H.leftChunk(q, x);  //  q ޵ x 
+                t = 0;
+            }
+            return -1;
+        }
+    };
+
+    //  ci Ҳı߽α꣺βѯ߶ȵݼ xҲĲ x ӣΪ n
+    struct RightCursor {
+        const ParallelHistogram& H;
+        int q;
+        size_t t;
+        RightCursor(const ParallelHistogram& hist, int ci) : H(hist), q(ci + 1), t(0) {}
+        long long find(int x) {
+            int k = (int)H.chunks.size();
+            while (q < k) {
+                const std::vector<long long>& s = H.chunks[q].prefixMins;
+                while (t < s.size() && H.h[s[t]] > x) t++;
+                if (t < s.size()) return s[t];
+                q = H.rightChunk(q, x);
+                t = 0;
+            }
+            return H.n;
+        }
+    };
+
+    // ڵջʱȷ Rջʱȷ Lջαң
+    void scan(int ci) {
+        Chunk& c = chunks[ci];
+        Stack<long long> stk((int)std::min<long long>(c.hi - c.lo, 1 << 20));
+        Stack<long long> left((int)std::min<long long>(c.hi - c.lo, 1 << 20));  //  stk Ӧ L
+        LeftCursor lc(*this, ci);
+        RightCursor rc(*this, ci);
+        long long best = 0;
+        for (long long i = c.lo; i < c.hi; ++i) {
+            while (!stk.empty() && h[stk.top()] >= h[i]) {
+                long long j = stk.pop();
+                best = std::max(best, (long long)h[j] * (i - left.pop() - 1));
+            }
+            left.push(stk.empty() ? lc.find(h[i]) : stk.top());
+            stk.push(i);
+        }
+        while (!stk.empty()) {
+            long long j = stk.pop();
+            best = std::max(best, (long long)h[j] * (rc.find(h[j]) - left.pop() - 1));
+        }
+        c.best = best;
+    }
+
+public:
+    ParallelHistogram(const int* heights, long long count) : h(heights), n(count) {}
+
+    long long run(int chunkCount) {
+        ForkJoinPool& pool = ForkJoinPool::instance();
+        if (chunkCount <= 0) chunkCount = pool.workerCount() * 4;
+        const long long MIN_CHUNK = 1 << 16;
+        if (chunkCount > n / MIN_CHUNK) chunkCount = (int)(n / MIN_CHUNK);
+        if (chunkCount <= 1) return largestRectangle(h, n);
+
+        chunks.resize(chunkCount);
+        for (int c = 0; c < chunkCount; ++c) {
+            chunks[c].lo = n * c / chunkCount;
+            chunks[c].hi = n * (c + 1) / chunkCount;
+        }
+        TaskGroup g(pool);
+        for (int c = 0; c < chunkCount; ++c) g.spawn([this, c] { summarize(chunks[c]); });
+        g.sync();
+        buildSparseTable();
+        for (int c = 0; c < chunkCount; ++c) g.spawn([this, c] { scan(c); });
+        g.sync();
+
+        long long best = 0;
+        for (const Chunk& c : chunks) best = std::max(best, c.best);
+        return best;
+    }
+};
+
+inline long long largestRectangleParallel(const int* heights, long long n, int chunks = 0) {
+    return ParallelHistogram(heights, n).run(chunks);
+}
+
+// ʽ汾߶ʱɲѯǰ
+// ջÿһ¼һԿӣ߶ȼ쵽㡣
+// ¸߶ȵʱвӣǵľڴ˴սᣩ
+// ÿ߶ջջһΣ̯ O(1)ڴֻջдйء
+class HistogramStream {
+private:
+    struct Bar {
+        long long start;  // ø߶Ⱦε±
+        int height;
+    };
+
+    Stack<Bar> _stk;      // ߶ϸĵջ
+    long long _count;     // ѽյ
+    long long _best;      // սе
+
+    static const uint32_t MAGIC = 0x31545348;  // "HST1"
+
+public:
+    HistogramStream() : _count(0), _best(0) {}
+
+    // һӵĸ߶
+    void push(int height) {
+        if (height < 0) throw std::invalid_argument("Height must be non-negative");
+        long long start = _count;
+        while (!_stk.empty() && _stk.top().height >= height) {
+            Bar bar = _stk.pop();
+            _best = std::max(_best, (long long)bar.height * (_count - bar.start));
+            start = bar.start;
+        }
+        Bar bar = { start, height };
+        _stk.push(bar);
+        _count++;
+    }
+
+    // ǰսľľȡO(ջ)
+    long long maxArea() const {
+        long long best = _best;
+        long long count = _count;
+        auto visit = [&best, count](const Bar& bar) {
+            best = std::max(best, (long long)bar.height * (count - bar.start));
+        };
+        _stk.traverse(visit);
+        return best;
+    }
+
+    long long count() const { return _count; }       // ѽյ
+    int liveBars() const { return _stk.size(); }     // ջд
+
+    // ״̬¿ʼ
+    void reset() {
+        _stk.clear();
+        _count = _best = 0;
+    }
+
+    // 㣺дսջݣƣջǰ
+    void checkpoint(std::ostream& out) const {
+        int n = _stk.size();
+        Bar* bars = new Bar[n > 0 ? n : 1];
+        int k = n;
+        auto collect = [&bars, &k](const Bar& bar) { bars[--k] = bar; };  // traverse ջ
+        _stk.traverse(collect);
+        uint32_t magic = MAGIC;
+        out.write(reinterpret_cast<const char*>(&magic), sizeof magic);
+        out.write(reinterpret_cast<const char*>(&_count), sizeof _count);
+        out.write(reinterpret_cast<const char*>(&_best), sizeof _best);
+        out.write(reinterpret_cast<const char*>(&n), sizeof n);
+        for (int i = 0; i < n; ++i) {
+            out.write(reinterpret_cast<const char*>(&bars[i].start), sizeof bars[i].start);
+            out.write(reinterpret_cast<const char*>(&bars[i].height), sizeof bars[i].height);
+        }
+        delete[] bars;
+        if (!out) throw std::runtime_error("Checkpoint write failed");
+    }
+
+    // Ӽָݲʽʱ׳쳣Ҳ޸ĵǰ״̬
+    void restore(std::istream& in) {
+        uint32_t magic = 0;
+        long long count = 0, best = 0;
+        int n = 0;
+        in.read(reinterpret_cast<char*>(&magic), sizeof magic);
+        in.read(reinterpret_cast<char*>(&count), sizeof count);
+        in.read(reinterpret_cast<char*>(&best), sizeof best);
+        in.read(reinterpret_cast<char*>(&n), sizeof n);
+        if (!in || magic != MAGIC || n < 0 || count < n || best < 0)
+            throw std::runtime_error("Invalid checkpoint");
+        // n ļܾݴԤȷ䣺ջ𻵵 n ֻᵼ¶ȡʧ
+        Stack<Bar> stk;
+        for (int i = 0; i < n; ++i) {
+            Bar bar;
+            in.read(reinterpret_cast<char*>(&bar.start), sizeof bar.start);
+            in.read(reinterpret_cast<char*>(&bar.height), sizeof bar.height);
+            if (!in || bar.height < 0 || bar.start < 0 || bar.start >= count)
+                throw std::runtime_error("Invalid checkpoint");
+            // push Ĳʽջ߶Ⱦϸ
+            if (!stk.empty() && (bar.start <= stk.top().start || bar.height <= stk.top().height))
+                throw std::runtime_error("Invalid checkpoint");
+            stk.push(bar);
+        }
+        _stk = stk;
+        _count = count;
+        _best = best;
+    }
+};
+
+#endif // HISTOGRAM_H
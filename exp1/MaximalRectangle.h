@@ -0,0 +1,232 @@
+#ifndef MAXIMALRECTANGLE_H
+#define MAXIMALRECTANGLE_H
+
+#include "Histogram.h"
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ֵȫ 1 
+// аÿ 1 ĸ״ͼ߶ȣÿһе״ͼںˡ
+// λѹ洢ÿɸ 64 λ֣100000 x 100000 ľԼռ 1.25GB
+// ʽȡļʱֻ賣פһлһ߶ȣڴ档
+
+// λѹֵ
+class BitMatrix {
+private:
+    long long _rows, _cols, _words;  // ÿе
+    std::vector<uint64_t> _bits;
+
+    // ȼзǸ˻ٷ
+    static size_t totalWords(long long rows, long long cols) {
+        if (rows < 0 || cols < 0) throw std::invalid_argument("Negative matrix size");
+        long long words = cols / 64 + (cols % 64 != 0);
+        if (words != 0 && (unsigned long long)rows > std::vector<uint64_t>().max_size() / words)
+            throw std::length_error("Matrix too large");
+        return (size_t)rows * (size_t)words;
+    }
+
+public:
+    explicit BitMatrix(long long rows = 0, long long cols = 0)
+        : _rows(rows), _cols(cols), _words(cols / 64 + (cols % 64 != 0)), _bits(totalWords(rows, cols), 0) {}
+
+    //  '0'/'1' ַ
+    explicit BitMatrix(const std::vector<std::string>& m)
+        : BitMatrix((long long)m.size(), m.empty() ? 0 : (long long)m[0].size()) {
+        for (long long r = 0; r < _rows; ++r) {
+            if ((long long)m[r].size() != _cols) throw std::invalid_argument("Ragged matrix");
+            for (long long c = 0; c < _cols; ++c) set(r, c, m[r][c] == '1');
+        }
+    }
+
+    long long rows() const { return _rows; }
+    long long cols() const { return _cols; }
+    long long wordsPerRow() const { return _words; }
+    //  &_bits[...]Ϊ 0 ʱ _bits Ϊգ±ʼԽ
+    const uint64_t* row(long long r) const { return _bits.data() + r * _words; }
+    uint64_t* row(long long r) { return _bits.data() + r * _words; }
+
+    bool get(long long r, long long c) const { return (row(r)[c >> 6] >> (c & 63)) & 1; }
+    void set(long long r, long long c, bool v) {
+        uint64_t mask = (uint64_t)1 << (c & 63);
+        if (v) row(r)[c >> 6] |= mask; else row(r)[c >> 6] &= ~mask;
+    }
+};
+
+// ==================== λѹļ ====================
+// ʽħ "BMX1"(4 ֽ) | (int64) | (int64) | е 64 λ֣СˣβλΪ 0
+
+class BitMatrixReader {
+private:
+    FILE* _fp;
+    long long _rows, _cols, _words, _next;
+
+public:
+    // ļͷеţǸļʵʣֽ
+    // óȽϣڴľڴ
+    explicit BitMatrixReader(const char* path) : _fp(std::fopen(path, "rb")), _next(0) {
+        if (!_fp) throw std::runtime_error(std::string("Cannot open matrix file: ") + path);
+        char magic[4];
+        bool ok = std::fread(magic, 1, 4, _fp) == 4 && std::string(magic, 4) == "BMX1" &&
+                  std::fread(&_rows, sizeof _rows, 1, _fp) == 1 &&
+                  std::fread(&_cols, sizeof _cols, 1, _fp) == 1 && _rows >= 0 && _cols >= 0;
+        if (ok) {
+            _words = _cols / 64 + (_cols % 64 != 0);
+            long pos = std::ftell(_fp);
+            ok = pos >= 0 && std::fseek(_fp, 0, SEEK_END) == 0;
+            long end = ok ? std::ftell(_fp) : -1;
+            ok = ok && end >= pos && std::fseek(_fp, pos, SEEK_SET) == 0;
+            long long avail = ok ? (end - pos) / (long long)sizeof(uint64_t) : 0;  // ʣ
+            ok = ok && (_words == 0 || _rows <= avail / _words);
+        }
+        if (!ok) {
+            std::fclose(_fp);
+            throw std::runtime_error(std::string("Invalid matrix file: ") + path);
+        }
+    }
+    ~BitMatrixReader() { std::fclose(_fp); }
+    BitMatrixReader(const BitMatrixReader&) = delete;
+    BitMatrixReader& operator=(const BitMatrixReader&) = delete;
+
+    long long rows() const { return _rows; }
+    long long cols() const { return _cols; }
+
+    // ȡһе bufwordsPerRow ֣Ѷ귵 false
+    bool next(uint64_t* buf) {
+        if (_next == _rows) return false;
+        if (std::fread(buf, sizeof(uint64_t), _words, _fp) != (size_t)_words)
+            throw std::runtime_error("Truncated matrix file");
+        _next++;
+        return true;
+    }
+};
+
+inline BitMatrix loadBitMatrix(const char* path) {
+    BitMatrixReader in(path);
+    BitMatrix m(in.rows(), in.cols());
+    // жкȡָ룺row(rows) Խ磨վʱ row(0) ͬԽ磩
+    // Ϊ 0 ʱûݣжȡ
+    for (long long r = 0; m.wordsPerRow() > 0 && r < m.rows(); ++r)
+        if (!in.next(m.row(r))) throw std::runtime_error("Truncated matrix file");
+    return m;
+}
+
+inline void saveBitMatrix(const BitMatrix& m, const char* path) {
+    FILE* fp = std::fopen(path, "wb");
+    if (!fp) throw std::runtime_error(std::string("Cannot create matrix file: ") + path);
+    long long rows = m.rows(), cols = m.cols();
+    bool ok = std::fwrite("BMX1", 1, 4, fp) == 4 &&
+              std::fwrite(&rows, sizeof rows, 1, fp) == 1 &&
+              std::fwrite(&cols, sizeof cols, 1, fp) == 1;
+    for (long long r = 0; ok && m.wordsPerRow() > 0 && r < rows; ++r)
+        ok = std::fwrite(m.row(r), sizeof(uint64_t), m.wordsPerRow(), fp) == (size_t)m.wordsPerRow();
+    if (std::fclose(fp) != 0 || !ok) throw std::runtime_error("Matrix file write failed");
+}
+
+// ====================  ====================
+
+// һи¸߶ȣλΪ 1 ߶ȼ 1
+// д޷֧ʽڲ 64 ѭɱԶ
+inline void updateHeights(int* heights, const uint64_t* row, long long cols) {
+    long long full = cols >> 6;
+    for (long long w = 0; w < full; ++w) {
+        uint64_t word = row[w];
+        int* h = heights + (w << 6);
+        for (int b = 0; b < 64; ++b) {
+            int bit = (int)((word >> b) & 1);
+            h[b] = (h[b] + 1) & -bit;
+        }
+    }
+    for (long long c = full << 6; c < cols; ++c) {
+        int bit = (int)((row[c >> 6] >> (c & 63)) & 1);
+        heights[c] = (heights[c] + 1) & -bit;
+    }
+}
+
+//  [r0, r1) Уheights Ϊ r0 ֮ǰĸ߶ȣЩϵ
+inline long long maximalRectangleRows(const BitMatrix& m, long long r0, long long r1,
+                                      std::vector<int>& heights, Stack<long long>& stk) {
+    long long best = 0;
+    for (long long r = r0; r < r1; ++r) {
+        updateHeights(heights.data(), m.row(r), m.cols());
+        best = std::max(best, largestRectangle(heights.data(), m.cols(), stk));
+    }
+    return best;
+}
+
+// ȫ 1 
+// bands == 1߳дbands <= 0߳Զִbands > 1зִ
+// ʱȸ׸е 1 ȣ˳Ƴÿڸ߶ȣ
+inline long long maximalRectangle(const BitMatrix& m, int bands = 1) {
+    long long rows = m.rows(), cols = m.cols();
+    if (rows == 0 || cols == 0) return 0;
+    ForkJoinPool& pool = ForkJoinPool::instance();
+    if (bands <= 0) bands = pool.workerCount() * 2;
+    if (bands > rows) bands = (int)rows;
+    int stackCap = (int)std::min<long long>(cols + 1, 1 << 20);
+
+    if (bands <= 1) {
+        std::vector<int> heights(cols, 0);
+        Stack<long long> stk(stackCap);
+        return maximalRectangleRows(m, 0, rows, heights, stk);
+    }
+
+    std::vector<long long> start(bands + 1);
+    for (int b = 0; b <= bands; ++b) start[b] = rows * b / bands;
+    std::vector<std::vector<int>> entry(bands), bottom(bands);
+
+    // һ飺ȫ 0 ߶ȳõ׸е 1 
+    TaskGroup g(pool);
+    for (int b = 1; b < bands; ++b)
+        g.spawn([&, b] {
+            bottom[b - 1].assign(cols, 0);
+            for (long long r = start[b - 1]; r < start[b]; ++r)
+                updateHeights(bottom[b - 1].data(), m.row(r), cols);
+        });
+    g.sync();
+
+    // ˳Ƴÿڸ߶ȣȫ 1 нһȡ
+    entry[0].assign(cols, 0);
+    for (int b = 1; b < bands; ++b) {
+        long long len = start[b] - start[b - 1];
+        entry[b].resize(cols);
+        for (long long c = 0; c < cols; ++c)
+            entry[b][c] = bottom[b - 1][c] == len ? entry[b - 1][c] + (int)len : bottom[b - 1][c];
+        std::vector<int>().swap(bottom[b - 1]);
+    }
+
+    // ڶ飺Լĸ߶ջ
+    std::vector<long long> best(bands, 0);
+    for (int b = 0; b < bands; ++b)
+        g.spawn([&, b] {
+            Stack<long long> stk(stackCap);
+            best[b] = maximalRectangleRows(m, start[b], start[b + 1], entry[b], stk);
+        });
+    g.sync();
+    return *std::max_element(best.begin(), best.end());
+}
+
+//  '0'/'1' ַ
+inline long long maximalRectangle(const std::vector<std::string>& matrix) {
+    return maximalRectangle(BitMatrix(matrix));
+}
+
+// ʽȡλѹļ⣺ֻһл壬ʺϷŲڴľ
+inline long long maximalRectangleFile(const char* path) {
+    BitMatrixReader in(path);
+    long long cols = in.cols();
+    if (in.rows() == 0 || cols == 0) return 0;  // ʱδļС֤ܰ
+    std::vector<uint64_t> row((cols + 63) / 64);
+    std::vector<int> heights(cols, 0);
+    Stack<long long> stk((int)std::min<long long>(cols + 1, 1 << 20));
+    long long best = 0;
+    while (in.next(row.data())) {
+        updateHeights(heights.data(), row.data(), cols);
+        best = std::max(best, largestRectangle(heights.data(), cols, stk));
+    }
+    return best;
+}
+
+#endif // MAXIMALRECTANGLE_H
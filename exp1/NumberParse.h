@@ -0,0 +1,157 @@
+#ifndef NUMBERPARSE_H
+#define NUMBERPARSE_H
+
+#include <cfloat>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
+// ʮƸ strtod һ£ȷ룩
+// ﷨ִ [ . ִ ] [ (e|E) [+|-] ִ ]Сһλ֣
+// ţɱʽеһԪ㴦'e' ֮ûʱָͣ 'e' ֮ǰ
+//
+// ·ClingerЧֲ 19 λʱβ w ɾȷ 64 λ
+//  w <= 2^53  |ʮָ| <= 22 w  10^e ܾȷʾΪ double
+// һγ˷ȷĽִÿ 8 λ SWAR һβУ뻻㡣
+// Чֹࡢָ˻ std::from_charsC++17 ֮ǰΪ strtod
+
+namespace numparse {
+
+// Сȡ 8 ֽ
+inline uint64_t load8(const char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+// 8 ֽǷȫΪ '0'..'9'
+inline bool isEightDigits(uint64_t v) {
+    return (((v & 0xF0F0F0F0F0F0F0F0ull) |
+             (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull);
+}
+
+//  8 λַΪλλλ𼶺ϲγ˷
+inline uint32_t parseEightDigits(uint64_t v) {
+    const uint64_t mask = 0x000000FF000000FFull;
+    const uint64_t mul1 = 100 + (1000000ull << 32);
+    const uint64_t mul2 = 1 + (10000ull << 32);
+    v -= 0x3030303030303030ull;
+    v = (v * 10) + (v >> 8);
+    v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t)v;
+}
+
+inline bool isDigit(char c) { return (unsigned char)(c - '0') < 10; }
+
+// ɨִۼӵ wɨλãnd ۼЧλǰ㣩
+inline const char* scanDigits(const char* p, const char* last, uint64_t& w, int& nd) {
+    if (w == 0)  // ǰ㲻Ч
+        while (p != last && *p == '0') { ++p; }
+    while (last - p >= 8) {
+        uint64_t v = load8(p);
+        if (!isEightDigits(v)) break;
+        if (nd + 8 <= 19) w = w * 100000000 + parseEightDigits(v);
+        nd += 8;
+        p += 8;
+    }
+    while (p != last && isDigit(*p)) {
+        if (nd < 19) w = w * 10 + (uint64_t)(*p - '0');
+        ++nd;
+        ++p;
+    }
+    return p;
+}
+
+// 10^0 .. 10^22 ɾȷʾΪ double
+const double POW10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// ·׼ȷ
+inline double slowParse(const char* first, const char* last) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    double value = 0;
+    std::from_chars_result r = std::from_chars(first, last, value);
+    if (r.ec == std::errc()) return value;
+    // 硢ʱ from_chars д strtod  HUGE_VAL  0
+#endif
+    std::string buf(first, last);
+    return std::strtod(buf.c_str(), nullptr);
+}
+
+} // namespace numparse
+
+//  [first, last) ͷɹʱд value Ľλã
+// ͷʱ first Ҳ޸ value
+inline const char* parseNumber(const char* first, const char* last, double& value) {
+    using namespace numparse;
+    const char* p = first;
+    uint64_t w = 0;
+    int nd = 0;            // Чλ
+    long long exp10 = 0;   // ʮָ
+
+    const char* intEnd = scanDigits(p, last, w, nd);
+    bool any = intEnd != p;
+    p = intEnd;
+    if (p != last && *p == '.') {
+        const char* frac = p + 1;
+        const char* fracEnd = scanDigits(frac, last, w, nd);
+        if (!any && fracEnd == frac) return first;  //  "."
+        exp10 -= fracEnd - frac;  // Чֳ 19 λʱֵ׼ȷʱ·
+        p = fracEnd;
+    } else if (!any) {
+        return first;
+    }
+
+    if (p != last && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool neg = false;
+        if (q != last && (*q == '+' || *q == '-')) { neg = *q == '-'; ++q; }
+        if (q != last && isDigit(*q)) {
+            long long e = 0;
+            while (q != last && isDigit(*q)) {
+                if (e < 100000) e = e * 10 + (*q - '0');  // ָȻΪ 0 
+                ++q;
+            }
+            exp10 += neg ? -e : e;
+            p = q;
+        }
+    }
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    if (nd <= 19) {
+        if (w == 0) {
+            value = 0;
+            return p;
+        }
+        if (w <= ((uint64_t)1 << 53)) {
+            if (exp10 >= -22 && exp10 <= 22) {
+                value = exp10 < 0 ? (double)w / POW10[-exp10] : (double)w * POW10[exp10];
+                return p;
+            }
+            // ָԴ 22 ʱȰѶĲֳ˽βֻҪβԾȷ
+            if (exp10 > 22 && exp10 <= 22 + 15) {
+                uint64_t m = w;
+                long long k = exp10 - 22;
+                while (k > 0 && m <= ((uint64_t)1 << 53) / 10) { m *= 10; --k; }
+                if (k == 0) {
+                    value = (double)m * POW10[22];
+                    return p;
+                }
+            }
+        }
+    }
+#endif
+    value = slowParse(first, p);
+    return p;
+}
+
+#endif // NUMBERPARSE_H
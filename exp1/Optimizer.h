@@ -0,0 +1,255 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include "Expression.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ֽŻ compile()  eval() ֮
+// ȰѺ׺ֽ뻹ԭΪʽ DAGͼʱùϣԽṹͬĽȥأhash-consing
+// ͬһɳ۵ӱʽǿɾȥɴĽ㣬
+// ɺ׺ֽ룬õӱʽֻһΣʱԪá
+//
+// б任֤ԭλͬ
+// ؽϣ x*2*3  x*6Ϊĳֵʱ
+// x+0  -0.0 + 0 = +0.0 x/c  c Ϊ 2 ݣ1/c ȷʱдΪ˷
+
+// ͳƣλΪ㣨ָ
+struct OptStats {
+    int before = 0;   // Żǰָ
+    int after = 0;    // Żָ
+    int folded = 0;   // ۵
+    int cse = 0;      // ӱʽϲ
+    int reduced = 0;  // ǿдɾ
+    int dead = 0;     // ɾȥĽ
+};
+
+// DAG 㣺ҶΪڲΪ
+struct ExprNode {
+    OpCode op;
+    int a, b;      // ӽ±꣬һԪ b = -1ҶӾΪ -1
+    int slot;      // 
+    double value;  // ֵ
+};
+
+class ExprDag {
+private:
+    struct Key {
+        OpCode op;
+        int a, b, slot;
+        uint64_t bits;  // λȽϣ +0.0  -0.0
+        bool operator==(const Key& k) const {
+            return op == k.op && a == k.a && b == k.b && slot == k.slot && bits == k.bits;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            uint64_t h = k.bits * 0x9E3779B97F4A7C15ull;
+            h ^= ((uint64_t)(uint32_t)k.a << 32 | (uint32_t)k.b) + 0x7F4A7C159E3779B9ull + (h << 6) + (h >> 2);
+            h ^= ((uint64_t)k.op << 32 | (uint32_t)k.slot) + (h << 6) + (h >> 2);
+            return (size_t)h;
+        }
+    };
+
+    std::vector<ExprNode> _nodes;
+    std::unordered_map<Key, int, KeyHash> _index;
+    OptStats& _stats;
+
+    // һ½㣻мΪһιӱʽ
+    int intern(OpCode op, int a, int b, int slot, double value) {
+        Key k = { op, a, b, slot, 0 };
+        std::memcpy(&k.bits, &value, sizeof value);
+        std::unordered_map<Key, int, KeyHash>::iterator it = _index.find(k);
+        if (it != _index.end()) {
+            if (a >= 0) _stats.cse++;
+            return it->second;
+        }
+        ExprNode n = { op, a, b, slot, value };
+        _nodes.push_back(n);
+        _index.emplace(k, (int)_nodes.size() - 1);
+        return (int)_nodes.size() - 1;
+    }
+
+    bool isConst(int i) const { return _nodes[i].op == OP_PUSH; }
+    bool isConst(int i, double v) const {
+        return isConst(i) && _nodes[i].value == v && std::signbit(_nodes[i].value) == std::signbit(v);
+    }
+
+    // c Ϊ 2 ҵɾȷʾʱ true
+    static bool exactReciprocal(double c, double& r) {
+        if (c == 0 || !std::isfinite(c)) return false;
+        int e;
+        if (std::fabs(std::frexp(c, &e)) != 0.5) return false;
+        r = 1 / c;
+        return std::isfinite(r) && std::fabs(std::frexp(r, &e)) == 0.5;
+    }
+
+public:
+    explicit ExprDag(OptStats& stats) : _stats(stats) {}
+
+    const ExprNode& node(int i) const { return _nodes[i]; }
+    int size() const { return (int)_nodes.size(); }
+
+    int constant(double v) { return intern(OP_PUSH, -1, -1, 0, v); }
+    int variable(int slot) { return intern(OP_VAR, -1, -1, slot, 0); }
+
+    int negate(int a) {
+        if (isConst(a)) {
+            _stats.folded++;
+            return constant(-_nodes[a].value);
+        }
+        if (_nodes[a].op == OP_NEG) {  // -(-x) = x
+            _stats.reduced++;
+            return _nodes[a].a;
+        }
+        return intern(OP_NEG, a, -1, 0, 0);
+    }
+
+    int binary(OpCode op, int a, int b) {
+        if (isConst(a) && isConst(b) && !(op == OP_DIV && _nodes[b].value == 0)) {
+            double x = _nodes[a].value, y = _nodes[b].value, v = 0;
+            switch (op) {
+                case OP_ADD: v = x + y; break;
+                case OP_SUB: v = x - y; break;
+                case OP_MUL: v = x * y; break;
+                case OP_DIV: v = x / y; break;
+                default: break;
+            }
+            _stats.folded++;
+            return constant(v);
+        }
+        double r;
+        switch (op) {
+            case OP_MUL:
+                if (isConst(b, 1)) { _stats.reduced++; return a; }
+                if (isConst(a, 1)) { _stats.reduced++; return b; }
+                if (isConst(b, -1)) { _stats.reduced++; return negate(a); }
+                if (isConst(a, -1)) { _stats.reduced++; return negate(b); }
+                break;
+            case OP_SUB:
+                if (isConst(b, 0)) { _stats.reduced++; return a; }  // x - (+0) = x x = -0.0
+                break;
+            case OP_DIV:
+                if (isConst(b) && exactReciprocal(_nodes[b].value, r)) {
+                    _stats.reduced++;
+                    return binary(OP_MUL, a, constant(r));
+                }
+                break;
+            default: break;
+        }
+        return intern(op, a, b, 0, 0);
+    }
+};
+
+// Żֽ룬stats ǿʱдͳ
+// Ϊ compile()  optimize() Ľֲ
+inline Program optimize(const Program& prog, OptStats* stats = nullptr) {
+    OptStats st;
+    st.before = (int)prog.code.size();
+    ExprDag dag(st);
+
+    // ͼ׺˳ģֵջջдŽ±
+    std::vector<int> stk, temps(prog.temps, -1);
+    for (const Instr& in : prog.code) {
+        int b;
+        switch (in.op) {
+            case OP_PUSH: stk.push_back(dag.constant(in.value)); break;
+            case OP_VAR: stk.push_back(dag.variable(in.slot)); break;
+            case OP_NEG: stk.back() = dag.negate(stk.back()); break;
+            case OP_STORE: temps[in.slot] = stk.back(); break;
+            case OP_LOAD: stk.push_back(temps[in.slot]); break;
+            default:
+                b = stk.back();
+                stk.pop_back();
+                stk.back() = dag.binary(in.op, stk.back(), b);
+                break;
+        }
+    }
+    int root = stk.back();
+
+    // Ӹǿɴ㣬ͬʱͳÿ㱻õĴ
+    int n = dag.size();
+    std::vector<int> refs(n, 0);
+    std::vector<char> live(n, 0);
+    Stack<int> work;
+    work.push(root);
+    live[root] = 1;
+    int reachable = 1;
+    while (!work.empty()) {
+        const ExprNode& e = dag.node(work.pop());
+        int kids[2] = { e.a, e.b };
+        for (int k = 0; k < 2; ++k) {
+            if (kids[k] < 0) continue;
+            refs[kids[k]]++;
+            if (!live[kids[k]]) {
+                live[kids[k]] = 1;
+                reachable++;
+                work.push(kids[k]);
+            }
+        }
+    }
+    st.dead = n - reachable;
+
+    // ɺ׺ֽ룺õ״μʱԪ
+    // øΪȡһμ黹ʱԪ
+    Program out;
+    out.vars = prog.vars;
+    std::vector<int> slotOf(n, -1), pending(n, 0);
+    Stack<int> freeSlots;
+    int depth = 0;
+    Stack<std::pair<int, int> > frames;  // 㣬Ѵӽ
+    frames.push(std::make_pair(root, 0));
+    while (!frames.empty()) {
+        std::pair<int, int>& f = frames.top();
+        const ExprNode& e = dag.node(f.first);
+        Instr in = { e.op, e.slot, e.value };
+        if (f.second == 0 && slotOf[f.first] >= 0) {  // ѼʱԪ
+            in.op = OP_LOAD;
+            in.slot = slotOf[f.first];
+            if (--pending[f.first] == 0) freeSlots.push(slotOf[f.first]);
+            out.code.push_back(in);
+            if (++depth > out.maxDepth) out.maxDepth = depth;
+            frames.pop();
+            continue;
+        }
+        if (e.a < 0) {  // Ҷӣֱѹ룬ռʱԪ
+            out.code.push_back(in);
+            if (++depth > out.maxDepth) out.maxDepth = depth;
+            frames.pop();
+            continue;
+        }
+        if (f.second == 0 || (f.second == 1 && e.b >= 0)) {
+            int kid = f.second == 0 ? e.a : e.b;
+            f.second++;
+            frames.push(std::make_pair(kid, 0));
+            continue;
+        }
+        int id = f.first;
+        frames.pop();
+        in.slot = 0;
+        out.code.push_back(in);
+        if (e.b >= 0) depth--;
+        if (refs[id] > 1) {
+            int t = freeSlots.empty() ? out.temps++ : freeSlots.pop();
+            slotOf[id] = t;
+            pending[id] = refs[id] - 1;
+            Instr store = { OP_STORE, t, 0 };
+            out.code.push_back(store);
+        }
+    }
+
+    st.after = (int)out.code.size();
+    if (stats) *stats = st;
+    return out;
+}
+
+// 벢Ż
+inline Program compileOptimized(const std::string& expr, OptStats* stats = nullptr) {
+    return optimize(compile(expr), stats);
+}
+
+#endif // OPTIMIZER_H
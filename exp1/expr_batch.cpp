@@ -0,0 +1,251 @@
+// ʽÿһʽֵ˳
+// 룺g++ -O2 -std=c++17 -pthread expr_batch.cpp -o expr_batch
+// ÷expr_batch [ļ|-] [-o ļ] [--cache Ŀ] [--block MB] [--quiet]
+//
+// 밴ʽ루Ĭÿ 4MBܵͬãÿһдضϣ
+// µİвһ顣ڸз齻 fork/join ֵ̳߳дԼ壬
+// ȫɺ˳д˳һ¡
+//  %.17g ɾȷԭ "error: ԭ"ԭ
+// ͬıʽ淶ıͬ LRU ʱٱֵ
+// ʱڱ׼ϱ뵥ӳٵĶֱͼ
+#include "Expression.h"
+#include "../LRUCache.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+// ====================  ====================
+
+struct CacheEntry {
+    std::string key;     // 淶ıʽ
+    double value;
+    std::string error;   // ǿձʾֵ
+    CacheEntry(const std::string& k = std::string(), double v = 0, const std::string& e = std::string())
+        : key(k), value(v), error(e) {}
+};
+
+// н LRU 棺ShardedLRUCache ĹϣƬÿƬһ
+class ExprCache {
+private:
+    ShardedLRUCache<std::string, CacheEntry> _cache;
+
+public:
+    explicit ExprCache(size_t capacity) : _cache(capacity) {}
+
+    // ʱдĿƵͷ
+    bool get(const std::string& key, CacheEntry& out) { return _cache.get(key, out); }
+    void put(const CacheEntry& e) { _cache.put(e.key, e); }
+
+    CacheStats stats() { return _cache.stats(); }
+};
+
+// ==================== ӳֱͼ ====================
+
+//  k Ͱͳӳ [2^k, 2^(k+1)) 0  0 Ͱ
+struct LatencyHistogram {
+    static const int BUCKETS = 64;
+    long long count[BUCKETS];
+    LatencyHistogram() { std::memset(count, 0, sizeof count); }
+
+    void add(long long ns) {
+        int k = 0;
+        while (k < BUCKETS - 1 && (ns >> (k + 1)) > 0) k++;
+        count[k]++;
+    }
+    void merge(const LatencyHistogram& h) {
+        for (int k = 0; k < BUCKETS; k++) count[k] += h.count[k];
+    }
+    long long total() const {
+        long long t = 0;
+        for (int k = 0; k < BUCKETS; k++) t += count[k];
+        return t;
+    }
+    // λͰϽ磨룩
+    long long quantile(double q) const {
+        long long need = (long long)(q * total()), seen = 0;
+        for (int k = 0; k < BUCKETS; k++) {
+            seen += count[k];
+            if (seen > need) return 2LL << k;
+        }
+        return 0;
+    }
+};
+
+// ==================== ֵ ====================
+
+// 淶ȥհף/ʶַ֮ĿհױΪһո"1 2"  "12" 岻ͬ
+inline std::string normalize(const char* p, const char* end) {
+    std::string s;
+    bool pendingSpace = false;
+    for (; p != end; ++p) {
+        unsigned char c = (unsigned char)*p;
+        if (isspace(c)) { pendingSpace = !s.empty(); continue; }
+        if (pendingSpace) {
+            unsigned char prev = (unsigned char)s.back();
+            bool word = isalnum(c) || c == '.' || c == '_';
+            bool prevWord = isalnum(prev) || prev == '.' || prev == '_';
+            if (word && prevWord) s += ' ';
+            pendingSpace = false;
+        }
+        s += (char)c;
+    }
+    return s;
+}
+
+inline CacheEntry evaluateLine(const std::string& key) {
+    try {
+        return CacheEntry(key, eval(compile(key)));
+    } catch (const std::exception& e) {
+        return CacheEntry(key, 0, e.what());
+    }
+}
+
+struct Line { const char* begin; const char* end; };
+
+// һеֵ
+struct Part {
+    std::string out;
+    LatencyHistogram latency;
+};
+
+void evaluateLines(const Line* lines, size_t n, ExprCache& cache, Part& part) {
+    char buf[64];
+    CacheEntry e;
+    for (size_t i = 0; i < n; i++) {
+        auto start = std::chrono::steady_clock::now();
+        std::string key = normalize(lines[i].begin, lines[i].end);
+        if (!key.empty()) {
+            if (!cache.get(key, e)) {
+                e = evaluateLine(key);
+                cache.put(e);
+            }
+            if (e.error.empty()) {
+                std::snprintf(buf, sizeof buf, "%.17g", e.value);
+                part.out += buf;
+            } else {
+                part.out += "error: ";
+                part.out += e.error;
+            }
+        }
+        part.out += '\n';
+        auto end = std::chrono::steady_clock::now();
+        part.latency.add(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+}
+
+// ====================  ====================
+
+int main(int argc, char** argv) {
+    const char* inPath = "-";
+    const char* outPath = "-";
+    size_t cacheSize = 65536;
+    size_t blockBytes = 4 << 20;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-o" && i + 1 < argc) outPath = argv[++i];
+        else if (a == "--cache" && i + 1 < argc) cacheSize = std::strtoull(argv[++i], nullptr, 10);
+        else if (a == "--block" && i + 1 < argc) blockBytes = std::strtoull(argv[++i], nullptr, 10) << 20;
+        else if (a == "--quiet") quiet = true;
+        else if (a[0] != '-' || a == "-") inPath = argv[i];
+        else {
+            std::fprintf(stderr, "÷%s [ļ|-] [-o ļ] [--cache Ŀ] [--block MB] [--quiet]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (blockBytes == 0) blockBytes = 1 << 20;
+
+    FILE* in = std::strcmp(inPath, "-") == 0 ? stdin : std::fopen(inPath, "rb");
+    if (!in) { std::fprintf(stderr, "޷ļ %s\n", inPath); return 1; }
+    FILE* out = std::strcmp(outPath, "-") == 0 ? stdout : std::fopen(outPath, "wb");
+    if (!out) { std::fprintf(stderr, "޷ļ %s\n", outPath); return 1; }
+
+    const size_t LINES_PER_TASK = 2048;
+    ExprCache cache(cacheSize);
+    ForkJoinPool& pool = ForkJoinPool::instance();
+    LatencyHistogram latency;
+    long long totalLines = 0, totalBytes = 0;
+    std::vector<char> buf;
+    std::vector<Line> lines;
+    std::vector<Part> parts;
+    auto start = std::chrono::steady_clock::now();
+
+    bool eof = false;
+    size_t carry = 0;  // һĩβ
+    while (!eof || carry > 0) {
+        buf.resize(carry + blockBytes);
+        size_t got = eof ? 0 : std::fread(buf.data() + carry, 1, blockBytes, in);
+        if (got < blockBytes) eof = true;
+        size_t len = carry + got;
+        totalBytes += got;
+
+        // صһУѵļĩβʱ鴦
+        size_t cut = len;
+        if (!eof) {
+            while (cut > 0 && buf[cut - 1] != '\n') cut--;
+            if (cut == 0) {  // һб黹
+                carry = len;
+                blockBytes *= 2;
+                continue;
+            }
+        }
+
+        lines.clear();
+        const char* p = buf.data();
+        const char* end = buf.data() + cut;
+        while (p < end) {
+            const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            const char* stop = nl ? nl : end;
+            Line ln = { p, stop > p && stop[-1] == '\r' ? stop - 1 : stop };
+            lines.push_back(ln);
+            p = nl ? nl + 1 : end;
+        }
+
+        size_t tasks = (lines.size() + LINES_PER_TASK - 1) / LINES_PER_TASK;
+        parts.assign(tasks, Part());
+        {
+            TaskGroup g(pool);
+            for (size_t t = 0; t < tasks; t++) {
+                g.spawn([&, t] {
+                    size_t lo = t * LINES_PER_TASK;
+                    size_t n = std::min(LINES_PER_TASK, lines.size() - lo);
+                    evaluateLines(&lines[lo], n, cache, parts[t]);
+                });
+            }
+            g.sync();
+        }
+        for (size_t t = 0; t < tasks; t++) {
+            std::fwrite(parts[t].out.data(), 1, parts[t].out.size(), out);
+            latency.merge(parts[t].latency);
+        }
+        totalLines += (long long)lines.size();
+
+        carry = len - cut;
+        std::memmove(buf.data(), buf.data() + cut, carry);
+    }
+    std::fflush(out);
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (in != stdin) std::fclose(in);
+    if (out != stdout) std::fclose(out);
+
+    if (!quiet) {
+        CacheStats st = cache.stats();
+        long long lookups = st.hits + st.misses;
+        std::fprintf(stderr, " %lldֽ %lldʱ %.3fs%.0f /s%.1f MB/s߳ %d\n",
+                     totalLines, totalBytes, sec, totalLines / sec, totalBytes / sec / 1e6, pool.workerCount());
+        std::fprintf(stderr, " %lld / %lld%.1f%%̭ %lld\n", st.hits, lookups,
+                     lookups ? 100.0 * st.hits / lookups : 0.0, st.evictions);
+        std::fprintf(stderr, "ӳ p50 < %lldnsp99 < %lldnsp99.9 < %lldns\n",
+                     latency.quantile(0.5), latency.quantile(0.99), latency.quantile(0.999));
+        for (int k = 0; k < LatencyHistogram::BUCKETS; k++)
+            if (latency.count[k])
+                std::fprintf(stderr, "  [%lld, %lld)ns  %lld\n", k ? 1LL << k : 0LL, 2LL << k, latency.count[k]);
+    }
+    return 0;
+}
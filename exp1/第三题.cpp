@@ -1,16 +1,21 @@
 #include "Stack.h"
+#include "Histogram.h"
+#include "MaximalRectangle.h"
 #include <iostream>
 #include <vector>
 #include <cstdlib>
 #include <ctime>
+#include <sstream>
 
 using namespace std;
 
 // ״ͼڵջ
-int largestRectangleArea(vector<int>& heights) {
+//  long long߶ȶɴ 10^5 int ˻
+long long largestRectangleArea(vector<int>& heights) {
     Stack<int> stk;  // 洢ĵջ
-    int maxArea = 0;
+    long long maxArea = 0;
     int n = heights.size();
+    stk.reserve(n);  // һԤɨв
 
     for (int i = 0; i < n; ++i) {
         // ǰӸ߶СջӸ߶ʱջӵ
@@ -20,7 +25,7 @@ int largestRectangleArea(vector<int>& heights) {
             int height = heights[topIdx];
             int left = stk.empty() ? -1 : stk.top();  // ߽
             int width = i - left - 1;
-            maxArea = max(maxArea, height * width);
+            maxArea = max(maxArea, (long long)height * width);
         }
         stk.push(i);  // ǰջ
     }
@@ -32,7 +37,7 @@ int largestRectangleArea(vector<int>& heights) {
         int height = heights[topIdx];
         int left = stk.empty() ? -1 : stk.top();
         int width = n - left - 1;
-        maxArea = max(maxArea, height * width);
+        maxArea = max(maxArea, (long long)height * width);
     }
 
     return maxArea;
@@ -66,6 +71,90 @@ void testRandomCases() {
     }
 }
 
+// ʽԣ߶ȣ;㲢ָӦһԼһ
+void testStreaming() {
+    cout << "ʽԣ" << endl;
+    vector<int> heights = {2, 1, 5, 6, 2, 3, 4, 4, 0, 7};
+    HistogramStream stream;
+    stringstream snapshot;
+    for (size_t i = 0; i < heights.size(); ++i) {
+        stream.push(heights[i]);
+        cout << " " << heights[i] << " ǰ" << stream.maxArea() << endl;
+        if (i == heights.size() / 2) stream.checkpoint(snapshot);  // ;
+    }
+
+    HistogramStream resumed;
+    resumed.restore(snapshot);
+    for (size_t i = heights.size() / 2 + 1; i < heights.size(); ++i) {
+        resumed.push(heights[i]);
+    }
+    cout << "һԼ㣺" << largestRectangle(heights.data(), heights.size())
+         << "ʽ㣺" << stream.maxArea()
+         << "ָ" << resumed.maxArea() << endl;
+
+    // 𻵵ļӦܾƼ󣨲ӦԤȷ䣩ջڸ߶Ȳ
+    string good = snapshot.str();
+    string huge = good, disordered = good;
+    int bigN = 0x7FFFFFFF;
+    long long bigCount = bigN;
+    huge.replace(sizeof(uint32_t), sizeof bigCount, reinterpret_cast<const char*>(&bigCount), sizeof bigCount);
+    huge.replace(sizeof(uint32_t) + 2 * sizeof(long long), sizeof bigN, reinterpret_cast<const char*>(&bigN), sizeof bigN);
+    size_t firstHeight = sizeof(uint32_t) + 2 * sizeof(long long) + sizeof(int) + sizeof(long long);
+    int tooHigh = 1000;
+    disordered.replace(firstHeight, sizeof tooHigh, reinterpret_cast<const char*>(&tooHigh), sizeof tooHigh);
+    string cases[] = { huge, disordered };
+    for (const string& bad : cases) {
+        stringstream ss(bad);
+        try {
+            resumed.restore(ss);
+            cout << "𻵵ļδ" << endl;
+        } catch (const runtime_error& e) {
+            cout << "𻵵ļ㱻ܾ" << e.what() << endl;
+        }
+    }
+    cout << endl;
+}
+
+// ֵȫ1βԣи״ͼں
+void testMaximalRectangle() {
+    vector<string> matrix = {"10100", "10111", "11111", "10010"};
+    cout << "ֵΣ" << endl;
+    for (size_t i = 0; i < matrix.size(); ++i) cout << matrix[i] << endl;
+    BitMatrix m(matrix);
+    cout << "̣߳" << maximalRectangle(m) << "ִУ" << maximalRectangle(m, 2) << endl;
+
+    // ļдӦλһ£ʽӦڴһ
+    const char* path = "maximal_rectangle_test.bmx";
+    saveBitMatrix(m, path);
+    BitMatrix loaded = loadBitMatrix(path);
+    bool same = loaded.rows() == m.rows() && loaded.cols() == m.cols();
+    for (long long r = 0; same && r < m.rows(); ++r)
+        for (long long c = 0; same && c < m.cols(); ++c) same = loaded.get(r, c) == m.get(r, c);
+    cout << "ļ" << (same ? "һ" : "һ") << "ʽȡļ" << maximalRectangleFile(path) << endl;
+    saveBitMatrix(BitMatrix(), path);  // վͬ
+    cout << "վ" << loadBitMatrix(path).rows() << " ";
+    saveBitMatrix(BitMatrix(3, 0), path);  // Уû
+    cout << "3 x 0 " << loadBitMatrix(path).rows() << " " << endl;
+
+    // ļͷԶļʵʴСӦڷڴ֮ǰܾ
+    long long bad[][2] = { {1LL << 40, 1LL << 40}, {1LL << 62, 64}, {5, 64} };
+    for (auto& dims : bad) {
+        saveBitMatrix(m, path);
+        FILE* fp = fopen(path, "r+b");
+        fseek(fp, 4, SEEK_SET);
+        fwrite(dims, sizeof(long long), 2, fp);
+        fclose(fp);
+        try {
+            loadBitMatrix(path);
+            cout << "𻵵ļͷδ" << endl;
+        } catch (const runtime_error& e) {
+            cout << "𻵵ļͷܾ" << e.what() << endl;
+        }
+    }
+    cout << endl;
+    remove(path);
+}
+
 int main() {
     // ʾ1
     vector<int> heights1 = {2, 1, 5, 6, 2, 3};
@@ -79,8 +168,19 @@ int main() {
     cout << "룺heights = [2,4]" << endl;
     cout << "" << largestRectangleArea(heights2) << endl << endl;
 
+    //  int Χ10^5  10^5 ӣ 10^10
+    vector<int> tall(100000, 100000);
+    cout << "10^5  10^5 ӣ" << largestRectangleArea(tall)
+         << "64 λںˣ" << largestRectangle(tall.data(), tall.size()) << "" << endl << endl;
+
     // 
     testRandomCases();
 
+    // ʽ
+    testStreaming();
+
+    // ֵ
+    testMaximalRectangle();
+
     return 0;
 }
@@ -3,33 +3,15 @@
 #include <string>
 #include <cctype>
 #include <stdexcept>  // 쳣ͷļ
+#include <chrono>
+#include <vector>
+#include <ctime>
+#include "Expression.h"  // precedence / operateֵֽ
+#include "Optimizer.h"   // ֽŻ
+#include "NumberParse.h" // ֵ
 
 using namespace std;
 
-// ȼж
-int precedence(char op) {
-    switch(op) {
-        case '+':
-        case '-': return 1;
-        case '*':
-        case '/': return 2;
-        default: return 0; // '('0
-    }
-}
-
-// ִ
-double operate(double a, double b, char op) {
-    switch(op) {
-        case '+': return a + b;
-        case '-': return a - b;
-        case '*': return a * b;
-        case '/': 
-            if (b == 0) throw runtime_error("Division by zero");
-            return a / b;
-        default: throw runtime_error("Invalid operator");
-    }
-}
-
 // ַ
 double calculate(const string& expr) {
     Stack<double> numStack;  // ջʹģջ
@@ -44,24 +26,15 @@ double calculate(const string& expr) {
             continue;
         }
         
-        // ֣С
+        // ֣Сָʽȷ
         if (isdigit(expr[i]) || expr[i] == '.') {
-            double num = 0;
-            // 
-            while (i < n && isdigit(expr[i])) {
-                num = num * 10 + (expr[i] - '0');
-                i++;
-            }
-            // С
-            if (i < n && expr[i] == '.') {
-                i++;
-                double fraction = 0.1;
-                while (i < n && isdigit(expr[i])) {
-                    num += (expr[i] - '0') * fraction;
-                    fraction *= 0.1;
-                    i++;
-                }
+            double num;
+            const char* begin = expr.data() + i;
+            const char* end = parseNumber(begin, expr.data() + n, num);
+            if (end == begin) {  // С
+                throw runtime_error("Invalid character: .");
             }
+            i += end - begin;
             numStack.push(num);
         }
         // 
@@ -151,6 +124,83 @@ int main() {
         }
         cout << "-------------------------" << endl;
     }
-    
+
+    // ֵ compile() ͬһ׷룬ʽдʱʧ
+    constexpr double folded = constEval("3 + 4 * 2 / (1 - 5)");
+    static_assert(folded == 1, "ֵ");
+    cout << "ֵ 3 + 4 * 2 / (1 - 5) = " << folded << endl;
+
+    // һΡֵε calculate() Ա
+    cout << "ֵֽ" << endl;
+    for (int i = 0; i < numTests; i++) {
+        cout << "ʽ: " << testCases[i] << endl;
+        try {
+            Program prog = compile(testCases[i]);
+            double result = eval(prog);
+            cout << "ֽ볤: " << prog.code.size() << ": " << result << endl;
+        } catch (const exception& e) {
+            cout << ": " << e.what() << endl;
+        }
+    }
+    const int REPEAT = 1000000;
+    Program prog = compile(testCases[0]);
+    double sum = 0;
+    clock_t start = clock();
+    for (int k = 0; k < REPEAT; k++) sum += calculate(testCases[0]);
+    clock_t mid = clock();
+    for (int k = 0; k < REPEAT; k++) sum += eval(prog);
+    clock_t end = clock();
+    cout << REPEAT << " ֵ  calculate: " << (double)(mid - start) / CLOCKS_PER_SEC << "s"
+         << "  compile+eval: " << (double)(end - mid) / CLOCKS_PER_SEC << "s"
+         << "У " << sum << "" << endl;
+
+    // Ĺʽֵдֵ calculate() Ա
+    const int ROWS = 1 << 20;
+    Program formula = compile("x*2 + y/3");
+    vector<double> xs(ROWS), ys(ROWS), out(ROWS);
+    vector<string> texts(ROWS);
+    for (int k = 0; k < ROWS; k++) {
+        xs[k] = k % 1000;
+        ys[k] = 1 + k % 97;
+        texts[k] = to_string(k % 1000) + "*2 + " + to_string(1 + k % 97) + "/3";
+    }
+    const double* columns[2];
+    columns[formula.varIndex("x")] = xs.data();
+    columns[formula.varIndex("y")] = ys.data();
+    double rowSum = 0, batchSum = 0;
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    for (int k = 0; k < ROWS; k++) rowSum += calculate(texts[k]);
+    chrono::steady_clock::time_point t1 = chrono::steady_clock::now();
+    evalBatch(formula, columns, out.data(), ROWS);
+    chrono::steady_clock::time_point t2 = chrono::steady_clock::now();
+    for (int k = 0; k < ROWS; k++) batchSum += out[k];
+    double rowTime = chrono::duration<double>(t1 - t0).count();
+    double batchTime = chrono::duration<double>(t2 - t1).count();
+    cout << ROWS << "  x*2 + y/3   calculate: " << rowTime << "s"
+         << "  evalBatch: " << batchTime << "s" << rowTime / batchTime << " "
+         << "  У " << rowSum << " / " << batchSum << endl;
+
+    // Ż۵ӱʽǿ
+    string redundant = "(x*2 + 3*4) * (x*2 + 3*4) - (x*2 + 3*4) / 2 + y*1 - 0";
+    OptStats st;
+    Program plain = compile(redundant);
+    Program fast = optimize(plain, &st);
+    cout << "Ż " << redundant << endl
+         << "ָ " << st.before << " -> " << st.after << "۵ " << st.folded << "ӱʽ "
+         << st.cse << "ǿ " << st.reduced << " " << st.dead << "ʱԪ "
+         << fast.temps << "" << endl;
+    const double* cols[2];
+    cols[plain.varIndex("x")] = xs.data();
+    cols[plain.varIndex("y")] = ys.data();
+    vector<double> outFast(ROWS);
+    t0 = chrono::steady_clock::now();
+    evalBatch(plain, cols, out.data(), ROWS);
+    t1 = chrono::steady_clock::now();
+    evalBatch(fast, cols, outFast.data(), ROWS);
+    t2 = chrono::steady_clock::now();
+    cout << ROWS << "   δŻ: " << chrono::duration<double>(t1 - t0).count() << "s"
+         << "  Ż: " << chrono::duration<double>(t2 - t1).count() << "s"
+         << "  " << (out == outFast ? "һ" : "һ") << endl;
+
     return 0;
 }